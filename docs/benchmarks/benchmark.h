@@ -0,0 +1,54 @@
+#ifndef _CPP_CAD_BENCHMARK_H
+#define _CPP_CAD_BENCHMARK_H
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+
+namespace benchmark
+{
+
+// Runs a function `repeat_c` times, and returns its mean wall time in
+// milliseconds.
+template <class Function>
+double time_ms(Function function, int repeat_c = 3)
+{
+    std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+
+    for (int c = 0; c < repeat_c; ++c)
+    {
+        function();
+    }
+
+    std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    return elapsed.count() / repeat_c;
+}
+
+inline void print_row_values()
+{
+    std::cout << std::endl;
+}
+
+template <class Value, class... Values>
+void print_row_values(const Value &value, const Values&... values)
+{
+    std::cout << std::setw(16) << std::right << value;
+    print_row_values(values...);
+}
+
+// Prints a table row of a label followed by values.
+template <class... Values>
+void print_row(const std::string &label, const Values&... values)
+{
+    std::cout << std::setw(32) << std::left << label;
+    print_row_values(values...);
+}
+
+}
+
+#endif // _CPP_CAD_BENCHMARK_H
@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <functional>
+#include <string>
+
+#include <cpp_cad.h>
+#include <cpp_cad/mesh_boolean_operations.h>
+
+#include "../benchmark.h"
+
+
+using cpp_cad::Aff_transformation_3;
+using cpp_cad::BooleanBackend;
+using cpp_cad::Polygon_2;
+using cpp_cad::Polyhedron_3;
+
+
+typedef std::function<Polyhedron_3(BooleanBackend)> Scene;
+
+
+void transform_polyhedron(Polyhedron_3 &polyhedron, const Aff_transformation_3 &transformation)
+{
+    std::transform(polyhedron.points_begin(), polyhedron.points_end(),
+        polyhedron.points_begin(), transformation);
+}
+
+void run_scene(const std::string &name, Scene scene)
+{
+    Polyhedron_3 res;
+    double nef_ms = benchmark::time_ms([&]()
+        {
+            res = scene(BooleanBackend::NEF);
+        });
+    int nef_facet_c = res.size_of_facets();
+
+    cpp_cad::mesh_boolean_statistics().reset();
+
+    double corefinement_ms = benchmark::time_ms([&]()
+        {
+            res = scene(BooleanBackend::COREFINEMENT);
+        });
+    int corefinement_facet_c = res.size_of_facets();
+
+    benchmark::print_row(name,
+        nef_ms, corefinement_ms, nef_facet_c, corefinement_facet_c,
+        cpp_cad::mesh_boolean_statistics().nef_fallback_count.load());
+}
+
+// Compares the Nef and corefinement boolean operation backends on the scenes
+// of the bundled examples:
+int main()
+{
+    benchmark::print_row("Scene",
+        "Nef (ms)", "Coref. (ms)", "Nef facets", "Coref. facets", "Fallbacks");
+
+    // docs/examples/solid_difference:
+    run_scene("solid_difference", [](BooleanBackend backend)
+        {
+            Polyhedron_3 cube;
+            Polyhedron_3 sphere;
+
+            cube.add_cube(10, 10, 10);
+            sphere.add_spherical_tessalation(10, 16);
+
+            return cpp_cad::difference(cube, sphere, backend);
+        });
+
+    // docs/examples/linear_extrude:
+    run_scene("linear_extrude", [](BooleanBackend backend)
+        {
+            Polygon_2 p1 {
+                {-1,  1},
+                { 0, -1},
+                { 1,  1}
+            };
+            Polygon_2 p2 {
+                { 1,  1},
+                { 0, -1},
+                {-1,  1}
+            };
+            Polyhedron_3 extrusion1;
+            Polyhedron_3 extrusion2;
+
+            p2.translate(0, 0, 15);
+            extrusion1.add_linear_extrusion(p1, 10);
+            extrusion2.add_linear_extrusion(p2, 5);
+
+            return cpp_cad::join(extrusion1, extrusion2, backend);
+        });
+
+    // docs/examples/rotate_extrude:
+    run_scene("rotate_extrude", [](BooleanBackend backend)
+        {
+            Polygon_2 triangle {
+                { 20,    20},
+                { 10,     0},
+                {  0.1,  10}
+            };
+            Polygon_2 square = Polygon_2::make_square(10, 10);
+            Polygon_2 circle = Polygon_2::make_circle(5);
+            Polyhedron_3 triangle_extrusion;
+            Polyhedron_3 square_extrusion;
+            Polyhedron_3 circle_extrusion;
+
+            square.translate(15, 0);
+            circle.translate(20, 0);
+
+            triangle_extrusion.add_rotate_extrusion(triangle);
+            square_extrusion.add_rotate_extrusion(square, M_PI);
+            transform_polyhedron(square_extrusion,
+                Aff_transformation_3::translate(0, 0, 30));
+            circle_extrusion.add_rotate_extrusion(circle, M_PI_2);
+            transform_polyhedron(circle_extrusion,
+                Aff_transformation_3::translate(0, 0, 35));
+            transform_polyhedron(circle_extrusion,
+                Aff_transformation_3::rotate_z(M_PI * 3 / 2));
+
+            return cpp_cad::join(
+                cpp_cad::join(triangle_extrusion, square_extrusion, backend),
+                circle_extrusion, backend);
+        });
+
+    return 0;
+}
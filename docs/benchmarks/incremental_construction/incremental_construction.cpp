@@ -0,0 +1,101 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include <cpp_cad.h>
+
+#include "../benchmark.h"
+
+
+using cpp_cad::Aff_transformation_3;
+using cpp_cad::Polyhedron_3;
+
+
+std::atomic<unsigned long> allocation_count(0);
+
+
+void *operator new(std::size_t size)
+{
+    ++allocation_count;
+
+    void *res = std::malloc(size == 0 ? 1 : size);
+
+    if (res == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return res;
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+
+// Adds a cube to polyhedra of increasing sizes.  The allocations, and time
+// per cube should stay the same, since the modifiers, and builders don't
+// copy the polyhedron they add to.  Fails, if the allocations per cube
+// differ between the sizes.
+int main()
+{
+    // Keeps one-time initialization out of the first count:
+    {
+        Polyhedron_3 warm_up;
+
+        warm_up.add_cube(1, 1, 1);
+    }
+
+    benchmark::print_row("Spheres", "Facets", "Cube allocs", "Cube (ms)");
+
+    unsigned long first_cube_allocation_c = 0;
+    bool is_constant = true;
+
+    for (int sphere_c = 1; sphere_c <= 1000; sphere_c *= 10)
+    {
+        Polyhedron_3 p;
+
+        for (int i = 0; i < sphere_c; ++i)
+        {
+            p.add_spherical_tessalation(
+                1, 32, Aff_transformation_3::translate(3 * i, 0, 0));
+        }
+
+        unsigned long start_c = allocation_count;
+
+        p.add_cube(1, 1, 1);
+
+        unsigned long cube_allocation_c = allocation_count - start_c;
+
+        if (sphere_c == 1)
+        {
+            first_cube_allocation_c = cube_allocation_c;
+        }
+        else if (cube_allocation_c != first_cube_allocation_c)
+        {
+            is_constant = false;
+        }
+
+        benchmark::print_row(std::to_string(sphere_c),
+            p.size_of_facets(), cube_allocation_c,
+            benchmark::time_ms([&p]() { p.add_cube(1, 1, 1); }, 10));
+    }
+
+    if (!is_constant)
+    {
+        std::cerr << "The allocations per cube depend on the polyhedron's "
+            "size." << std::endl;
+
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+
+#include <cpp_cad.h>
+
+#include "../benchmark.h"
+
+
+using cpp_cad::Nef_polyhedron_3;
+using cpp_cad::Polygon_2;
+using cpp_cad::Polyhedron_3;
+
+
+std::atomic<unsigned long> allocation_count(0);
+
+
+void *operator new(std::size_t size)
+{
+    ++allocation_count;
+
+    void *res = std::malloc(size == 0 ? 1 : size);
+
+    if (res == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return res;
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+
+typedef std::function<Nef_polyhedron_3()> Factory;
+
+
+// Returns the number of allocations of a call.
+unsigned long count_allocations(Factory factory)
+{
+    unsigned long start_c = allocation_count;
+
+    factory();
+
+    return allocation_count - start_c;
+}
+
+// Compares building a primitive into a polyhedron, and converting it, to the
+// factory, which converts a surface mesh:
+void run_primitive(const std::string &name,
+    std::function<void(Polyhedron_3 &)> add_primitive, Factory factory)
+{
+    Factory through_polyhedron = [&add_primitive]()
+        {
+            Polyhedron_3 p;
+
+            add_primitive(p);
+
+            return Nef_polyhedron_3(p);
+        };
+
+    benchmark::print_row(name,
+        count_allocations(through_polyhedron), count_allocations(factory),
+        benchmark::time_ms(through_polyhedron, 10),
+        benchmark::time_ms(factory, 10));
+}
+
+int main()
+{
+    Polygon_2 triangle {
+        { 20,    20},
+        { 10,     0},
+        {  0.1,  10}
+    };
+
+    benchmark::print_row("Primitive",
+        "Polyh. allocs", "Mesh allocs", "Polyh. (ms)", "Mesh (ms)");
+
+    run_primitive("cube",
+        [](Polyhedron_3 &p) { p.add_cube(10, 10, 10); },
+        []() { return Nef_polyhedron_3::make_cube(10, 10, 10); });
+    run_primitive("cylinder",
+        [](Polyhedron_3 &p) { p.add_cylindrical_tessalation(5, 5, 10, 32); },
+        []() { return Nef_polyhedron_3::make_cylinder(5, 5, 10, 32); });
+    run_primitive("sphere",
+        [](Polyhedron_3 &p) { p.add_spherical_tessalation(10, 32); },
+        []() { return Nef_polyhedron_3::make_sphere(10, 32); });
+    run_primitive("linear_extrude",
+        [&triangle](Polyhedron_3 &p) { p.add_linear_extrusion(triangle, 10); },
+        [&triangle]() { return triangle.linear_extrude(10); });
+    run_primitive("rotate_extrude",
+        [&triangle](Polyhedron_3 &p)
+        {
+            p.add_rotate_extrusion(triangle, 2 * M_PI, 32);
+        },
+        [&triangle]() { return triangle.rotate_extrude(2 * M_PI, 32); });
+
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include <functional>
+#include <string>
+
+#include <cpp_cad.h>
+
+#include "../benchmark.h"
+
+
+using cpp_cad::Nef_polyhedron_3;
+
+
+typedef std::function<void(Nef_polyhedron_3 &)> Rotation;
+
+
+// Times drilling a cube with a cylinder, after rotating both with the same
+// rotation several times.
+void run_rotation(const std::string &name, Rotation rotation)
+{
+    Nef_polyhedron_3 cube = Nef_polyhedron_3::make_cube(10, 10, 10);
+    Nef_polyhedron_3 cylinder = Nef_polyhedron_3::make_cylinder(3, 3, 20, 16);
+
+    cylinder.translate(5, 5, -5);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        rotation(cube);
+        rotation(cylinder);
+        cube.apply_pending_transformation();
+        cylinder.apply_pending_transformation();
+    }
+
+    Nef_polyhedron_3 res;
+    double difference_ms = benchmark::time_ms([&]()
+        {
+            res = cube - cylinder;
+        });
+    double union_ms = benchmark::time_ms([&]()
+        {
+            res = res + cylinder;
+        });
+
+    benchmark::print_row(name, difference_ms, union_ms);
+}
+
+// Compares boolean operations on solids rotated with floating point, and with
+// rational sines and cosines:
+int main()
+{
+    benchmark::print_row("Rotation", "Difference (ms)", "Union (ms)");
+
+    run_rotation("none", [](Nef_polyhedron_3 &)
+        {});
+    run_rotation("rotate_z(90 deg)", [](Nef_polyhedron_3 &solid)
+        {
+            solid.rotate_z(M_PI_2);
+        });
+    run_rotation("rotate_z(30 deg)", [](Nef_polyhedron_3 &solid)
+        {
+            solid.rotate_z(M_PI / 6);
+        });
+    run_rotation("rational_rotate_z(30 deg)", [](Nef_polyhedron_3 &solid)
+        {
+            solid.rational_rotate_z(M_PI / 6);
+        });
+    run_rotation("rotate_x(30 deg)", [](Nef_polyhedron_3 &solid)
+        {
+            solid.rotate_x(M_PI / 6);
+        });
+    run_rotation("rational_rotate_x(30 deg)", [](Nef_polyhedron_3 &solid)
+        {
+            solid.rational_rotate_x(M_PI / 6);
+        });
+
+    return 0;
+}
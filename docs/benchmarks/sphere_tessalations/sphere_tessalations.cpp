@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <cpp_cad.h>
+
+#include "../benchmark.h"
+
+
+using cpp_cad::Nef_polyhedron_3;
+using cpp_cad::Polyhedron_3;
+using cpp_cad::SphereTessalation;
+
+
+const double sphere_r = 10;
+
+
+// Returns the largest distance between the sphere, and the planes of the
+// tessalation's triangles, which is the chord error of triangles that
+// contain their circumcenter.
+double max_chord_error(const Polyhedron_3 &tessalation)
+{
+    double res = 0;
+
+    for (Polyhedron_3::Facet_const_iterator fit = tessalation.facets_begin();
+        fit != tessalation.facets_end();
+        ++fit)
+    {
+        Polyhedron_3::Halfedge_const_handle h = fit->halfedge();
+        CGAL::Plane_3<cpp_cad::Kernel> plane(h->vertex()->point(),
+            h->next()->vertex()->point(), h->next()->next()->vertex()->point());
+        double distance = sqrt(CGAL::to_double(CGAL::squared_distance(
+            cpp_cad::Point_3(0, 0, 0), plane)));
+
+        res = std::max(res, sphere_r - distance);
+    }
+
+    return res;
+}
+
+// Returns the tessalation with the fewest subdivisions, whose chord error
+// isn't larger than `chord_error`.
+Polyhedron_3 find_tessalation(double chord_error, SphereTessalation tessalation)
+{
+    for (int subdivision_c = 3; ; ++subdivision_c)
+    {
+        Polyhedron_3 res;
+
+        res.add_spherical_tessalation(sphere_r, subdivision_c, tessalation);
+        if (max_chord_error(res) <= chord_error)
+        {
+            return res;
+        }
+    }
+}
+
+// Subtracts the sphere from a cube, as docs/examples/solid_difference does.
+double difference_ms(Polyhedron_3 &sphere)
+{
+    return benchmark::time_ms([&]()
+        {
+            Nef_polyhedron_3 cube = Nef_polyhedron_3::make_cube(10, 10, 10);
+            Nef_polyhedron_3 nef_sphere(sphere);
+
+            cube - nef_sphere;
+        });
+}
+
+void run_chord_error(double chord_error)
+{
+    Polyhedron_3 latitude_longitude =
+        find_tessalation(chord_error, SphereTessalation::LATITUDE_LONGITUDE);
+    Polyhedron_3 geodesic =
+        find_tessalation(chord_error, SphereTessalation::GEODESIC);
+
+    benchmark::print_row("chord error " + std::to_string(chord_error),
+        latitude_longitude.size_of_vertices(), geodesic.size_of_vertices(),
+        difference_ms(latitude_longitude), difference_ms(geodesic));
+}
+
+// Compares the latitude / longitude, and the geodesic sphere tessalations
+// at equal maximum chord errors of a sphere with radius 10, by their vertex
+// counts, and by the time to subtract them from a cube:
+int main()
+{
+    benchmark::print_row("Max. chord error",
+        "Lat./long. vert.", "Geodesic vert.",
+        "Lat./long. (ms)", "Geodesic (ms)");
+
+    run_chord_error(1);
+    run_chord_error(0.3);
+    run_chord_error(0.1);
+    run_chord_error(0.03);
+
+    return 0;
+}
@@ -0,0 +1,54 @@
+#include <iostream>
+#include <vector>
+
+#include <cpp_cad.h>
+
+#include "../benchmark.h"
+
+
+using cpp_cad::Nef_polyhedron_3;
+using cpp_cad::TessalationCache;
+
+
+// Builds a scene of 500 spheres of 5 sizes on a 10 x 10 x 5 grid, and
+// applies their placements, as a boolean operation would.
+std::vector<Nef_polyhedron_3> build_scene()
+{
+    std::vector<Nef_polyhedron_3> res;
+
+    for (int i = 0; i < 500; ++i)
+    {
+        Nef_polyhedron_3 sphere = Nef_polyhedron_3::make_sphere(
+            1 + i % 5, 16,
+            cpp_cad::Aff_transformation_3::translate(
+                20 * (i % 10), 20 * (i / 10 % 10), 20 * (i / 100)));
+
+        sphere.apply_pending_transformation();
+        res.push_back(sphere);
+    }
+
+    return res;
+}
+
+// Compares building the spheres of a 500 sphere scene, and copying, and
+// scaling cached unit spheres:
+int main()
+{
+    benchmark::print_row("Scene", "Built (ms)", "Cached (ms)");
+
+    Nef_polyhedron_3::cache_tessalations() = false;
+
+    double built_ms = benchmark::time_ms(build_scene, 1);
+
+    Nef_polyhedron_3::cache_tessalations() = true;
+    TessalationCache::shared().reset_statistics();
+
+    double cached_ms = benchmark::time_ms(build_scene, 1);
+
+    benchmark::print_row("500 spheres", built_ms, cached_ms);
+
+    std::cout << std::endl;
+    TessalationCache::shared().get_statistics().write(std::cout);
+
+    return 0;
+}
@@ -0,0 +1,85 @@
+#include <string>
+
+#include <cpp_cad.h>
+
+#include "../benchmark.h"
+
+
+using cpp_cad::Nef_polyhedron_3;
+
+
+// Applies a chain of rotations and translations, which returns the solid to
+// where it started after every 4 transforms.
+void transform_chain(Nef_polyhedron_3 &solid, int transform_c, bool is_eager)
+{
+    for (int i = 0; i < transform_c; ++i)
+    {
+        switch (i % 4)
+        {
+            case 0:
+                solid.rotate_z(M_PI_2);
+                break;
+
+            case 1:
+                solid.translate(0, 0, 35);
+                break;
+
+            case 2:
+                solid.rotate_z(M_PI * 3 / 2);
+                break;
+
+            default:
+                solid.translate(0, 0, -35);
+                break;
+        }
+
+        if (is_eager)
+        {
+            solid.apply_pending_transformation();
+        }
+    }
+
+    solid.apply_pending_transformation();
+}
+
+void run_chain(const std::string &name, const Nef_polyhedron_3 &solid,
+    int transform_c)
+{
+    double eager_ms = benchmark::time_ms([&]()
+        {
+            Nef_polyhedron_3 res(solid);
+
+            transform_chain(res, transform_c, true);
+        });
+    double deferred_ms = benchmark::time_ms([&]()
+        {
+            Nef_polyhedron_3 res(solid);
+
+            transform_chain(res, transform_c, false);
+        });
+
+    benchmark::print_row(name + " x " + std::to_string(transform_c),
+        eager_ms, deferred_ms);
+}
+
+// Compares applying each transform of a chain to the SNC, with composing
+// the chain, and applying it once:
+int main()
+{
+    Nef_polyhedron_3 sphere = Nef_polyhedron_3::make_sphere(10, 16);
+    cpp_cad::Polygon_2 circle = cpp_cad::Polygon_2::make_circle(5);
+
+    circle.translate(20, 0);
+
+    Nef_polyhedron_3 torus_part = circle.rotate_extrude(M_PI_2);
+
+    benchmark::print_row("Chain", "Eager (ms)", "Deferred (ms)");
+
+    for (int transform_c : { 1, 5, 10 })
+    {
+        run_chain("sphere", sphere, transform_c);
+        run_chain("rotate_extrude", torus_part, transform_c);
+    }
+
+    return 0;
+}
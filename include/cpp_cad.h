@@ -4,16 +4,25 @@
 #include <CGAL/Aff_transformation_3.h>
 #include <CGAL/Polygon_2.h>
 
+#include "cpp_cad/Async_nef_polyhedron_3.h"
+#include "cpp_cad/hull.h"
+#include "cpp_cad/Lazy_nef_polyhedron_3.h"
+#include "cpp_cad/minkowski_sum.h"
 #include "cpp_cad/Nef_polyhedron_3.h"
 #include "cpp_cad/Polygon_2.h"
+#include "cpp_cad/Surface_mesh_3.h"
+#include "cpp_cad/union_all.h"
 
 #include "cpp_cad/Polygon_2.cpp"
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 using CGAL::transform;
 
+}
 }
 
 #endif // _CPP_CAD_H
@@ -1,12 +1,17 @@
 #ifndef _CPP_CAD_AFF_TRANSFORMATION_3_H
 #define _CPP_CAD_AFF_TRANSFORMATION_3_H
 
+#include <cmath>
+#include <cstdlib>
+
 #include <CGAL/Aff_transformation_3.h>
 
 #include "reference_frame.h"
 
 
 namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
 {
     class Aff_transformation_3 : public CGAL::Aff_transformation_3<Kernel>
     {
@@ -15,6 +20,15 @@ namespace cpp_cad
         typedef CGAL::Aff_transformation_3<Kernel> CGAL_Aff_transformation_3;
         using CGAL_Aff_transformation_3::CGAL_Aff_transformation_3;
 
+        Aff_transformation_3()
+        : CGAL_Aff_transformation_3(CGAL::IDENTITY)
+        {}
+
+        // Converts the result of composing transformations:
+        Aff_transformation_3(const CGAL_Aff_transformation_3 &source)
+        : CGAL_Aff_transformation_3(source)
+        {}
+
         static Aff_transformation_3 translate(
             Kernel::FT x, Kernel::FT y, Kernel::FT z)
         {
@@ -41,69 +55,300 @@ namespace cpp_cad
             );
         }
 
+        // Rotations by angles within this many radians of a multiple of a
+        // right angle are exact:
+        static constexpr double right_angle_tolerance = 1e-12;
+
+        // The default tolerance in radians of rational rotations:
+        static constexpr double rational_rotation_tolerance = 1e-6;
+
         static Aff_transformation_3 rotate_x(double angle)
         {
+            Kernel::FT s, c;
+
+            sin_cos(angle, s, c);
+
             return Aff_transformation_3(
-                1,          0,           0,
-                0, cos(angle), -sin(angle),
-                0, sin(angle),  cos(angle)
+                1, 0,  0,
+                0, c, -s,
+                0, s,  c
             );
         }
 
         static Aff_transformation_3 rotate_x(double angle, double r)
         {
+            Kernel::FT s, c;
+
+            sin_cos(angle, s, c);
+
             return Aff_transformation_3(
-                1,          0,           0,              0,
-                0, cos(angle), -sin(angle), r * cos(angle),
-                0, sin(angle),  cos(angle), r * sin(angle)
+                1, 0,  0,     0,
+                0, c, -s, r * c,
+                0, s,  c, r * s
             );
         }
 
         static Aff_transformation_3 rotate_y(double angle)
         {
+            Kernel::FT s, c;
+
+            sin_cos(angle, s, c);
+
             return Aff_transformation_3(
-                 cos(angle), 0, sin(angle),
-                          0, 1,          0,
-                -sin(angle), 0, cos(angle)
+                 c, 0, s,
+                 0, 1, 0,
+                -s, 0, c
             );
         }
 
         static Aff_transformation_3 rotate_y(double angle, double r)
         {
+            Kernel::FT s, c;
+
+            sin_cos(angle, s, c);
+
             return Aff_transformation_3(
-                 cos(angle), 0, sin(angle), r * sin(angle),
-                          0, 1,          0,              0,
-                -sin(angle), 0, cos(angle), r * cos(angle)
+                 c, 0, s, r * s,
+                 0, 1, 0,     0,
+                -s, 0, c, r * c
             );
         }
 
         static Aff_transformation_3 rotate_z(double angle)
         {
+            Kernel::FT s, c;
+
+            sin_cos(angle, s, c);
+
             return Aff_transformation_3(
-                cos(angle), -sin(angle), 0,
-                sin(angle),  cos(angle), 0,
-                         0,           0, 1
+                c, -s, 0,
+                s,  c, 0,
+                0,  0, 1
             );
         }
 
         static Aff_transformation_3 rotate_z(double angle, double r)
         {
+            Kernel::FT s, c;
+
+            sin_cos(angle, s, c);
+
             return Aff_transformation_3(
-                cos(angle), -sin(angle), 0, r * cos(angle),
-                sin(angle),  cos(angle), 0, r * sin(angle),
-                         0,           0, 1,              0
+                c, -s, 0, r * c,
+                s,  c, 0, r * s,
+                0,  0, 1,     0
             );
         }
 
         static Aff_transformation_3 rotate_y_rotate_z(double y_angle, double z_angle)
         {
+            Kernel::FT y_s, y_c, z_s, z_c;
+
+            sin_cos(y_angle, y_s, y_c);
+            sin_cos(z_angle, z_s, z_c);
+
             return Aff_transformation_3(
-                cos(y_angle) * cos(z_angle), -sin(z_angle), sin(y_angle) * cos(z_angle),
-                cos(y_angle) * sin(z_angle),  cos(z_angle), sin(y_angle) * sin(z_angle),
-                              -sin(y_angle),             0, cos(y_angle)
+                y_c * z_c, -z_s, y_s * z_c,
+                y_c * z_s,  z_c, y_s * z_s,
+                     -y_s,    0,       y_c
             );
         }
 
+        // Rational rotations approximate the angle within a tolerance, by an
+        // angle whose sine and cosine are small rationals.  Their matrices
+        // are exactly orthogonal, and they add few bits to the exact
+        // coordinates of rotated solids, so later boolean operations stay
+        // fast.
+
+        static Aff_transformation_3 rational_rotate_x(
+            double angle, double tolerance = rational_rotation_tolerance)
+        {
+            Kernel::FT s, c;
+
+            rational_sin_cos(angle, tolerance, s, c);
+
+            return Aff_transformation_3(
+                1, 0,  0,
+                0, c, -s,
+                0, s,  c
+            );
+        }
+
+        static Aff_transformation_3 rational_rotate_y(
+            double angle, double tolerance = rational_rotation_tolerance)
+        {
+            Kernel::FT s, c;
+
+            rational_sin_cos(angle, tolerance, s, c);
+
+            return Aff_transformation_3(
+                 c, 0, s,
+                 0, 1, 0,
+                -s, 0, c
+            );
+        }
+
+        static Aff_transformation_3 rational_rotate_z(
+            double angle, double tolerance = rational_rotation_tolerance)
+        {
+            Kernel::FT s, c;
+
+            rational_sin_cos(angle, tolerance, s, c);
+
+            return Aff_transformation_3(
+                c, -s, 0,
+                s,  c, 0,
+                0,  0, 1
+            );
+        }
+
+        static Aff_transformation_3 rational_rotate_y_rotate_z(
+            double y_angle, double z_angle,
+            double tolerance = rational_rotation_tolerance)
+        {
+            Kernel::FT y_s, y_c, z_s, z_c;
+
+            rational_sin_cos(y_angle, tolerance, y_s, y_c);
+            rational_sin_cos(z_angle, tolerance, z_s, z_c);
+
+            return Aff_transformation_3(
+                y_c * z_c, -z_s, y_s * z_c,
+                y_c * z_s,  z_c, y_s * z_s,
+                     -y_s,    0,       y_c
+            );
+        }
+
+        // Returns the sine and cosine of an angle.  They're exact for
+        // multiples of a right angle.
+        static void sin_cos(double angle, Kernel::FT &s, Kernel::FT &c)
+        {
+            double remainder;
+            int quarter_turn_c = split_quarter_turns(angle, remainder);
+
+            if (std::abs(remainder) <= right_angle_tolerance)
+            {
+                quarter_turn(quarter_turn_c, 0, 1, s, c);
+            }
+            else
+            {
+                s = sin(angle);
+                c = cos(angle);
+            }
+        }
+
+        // Returns the exact sine and cosine of an angle within `tolerance`
+        // of the given one.
+        //     The angle is reduced to within 45 degrees of a multiple of a
+        // right angle.  The tangent, t, of half the remainder is approximated
+        // by the continued fraction convergents, p / q, until the angle
+        //     2 atan(p / q)
+        // is close enough.  Its sine, and cosine
+        //     2 p q / (p^2 + q^2), (q^2 - p^2) / (p^2 + q^2)
+        // form a Pythagorean triple with the denominator.
+        static void rational_sin_cos(
+            double angle, double tolerance, Kernel::FT &s, Kernel::FT &c)
+        {
+            double remainder;
+            int quarter_turn_c = split_quarter_turns(angle, remainder);
+            double t = std::abs(tan(remainder / 2));
+            // Convergents p / q, and the previous ones:
+            long long p = 0, q = 1;
+            long long previous_p = 1, previous_q = 0;
+            double fraction = t;
+
+            // Stop before p^2 + q^2 overflows:
+            const long long max_q = 1LL << 30;
+
+            while (std::abs(2 * atan(double(p) / q) - std::abs(remainder)) >
+                tolerance)
+            {
+                fraction = 1 / (fraction - floor(fraction));
+
+                // An exact fraction leaves an infinite remainder, which
+                // mustn't be converted to an integer:
+                if (!std::isfinite(fraction) || fraction > max_q)
+                {
+                    break;
+                }
+
+                long long a = static_cast<long long>(floor(fraction));
+
+                if (a * q + previous_q > max_q)
+                {
+                    break;
+                }
+
+                long long next_p = a * p + previous_p;
+                long long next_q = a * q + previous_q;
+
+                previous_p = p;
+                previous_q = q;
+                p = next_p;
+                q = next_q;
+            }
+
+            if (remainder < 0)
+            {
+                p = -p;
+            }
+
+            // |p| <= q <= 2^30 fit an int, whose FT constructor is exact on
+            // all kernels.  The squares are formed in FT arithmetic, since
+            // FT may not have an exact constructor from a long long:
+            const Kernel::FT exact_p(static_cast<int>(p));
+            const Kernel::FT exact_q(static_cast<int>(q));
+            const Kernel::FT d = exact_p * exact_p + exact_q * exact_q;
+
+            quarter_turn(quarter_turn_c,
+                Kernel::FT(2) * exact_p * exact_q / d,
+                (exact_q * exact_q - exact_p * exact_p) / d,
+                s, c);
+        }
+
+        private:
+
+        // Splits an angle into the nearest multiple of a right angle, and the
+        // remainder.  Returns the multiple modulo 4.
+        static int split_quarter_turns(double angle, double &remainder)
+        {
+            double quarter_turn_c = std::round(angle / M_PI_2);
+
+            remainder = angle - quarter_turn_c * M_PI_2;
+
+            return ((static_cast<long long>(quarter_turn_c) % 4) + 4) % 4;
+        }
+
+        // Rotates the sine and cosine of an angle by quarter turns.
+        static void quarter_turn(
+            int quarter_turn_c, const Kernel::FT &angle_s,
+            const Kernel::FT &angle_c, Kernel::FT &s, Kernel::FT &c)
+        {
+            switch (quarter_turn_c)
+            {
+                case 0:
+                    s = angle_s;
+                    c = angle_c;
+                    break;
+
+                case 1:
+                    s = angle_c;
+                    c = -angle_s;
+                    break;
+
+                case 2:
+                    s = -angle_s;
+                    c = -angle_c;
+                    break;
+
+                default:
+                    s = -angle_c;
+                    c = angle_s;
+                    break;
+            }
+        }
+
+        public:
+
         static const Aff_transformation_3& swap_yz()
         {
             static Aff_transformation_3 res(
@@ -137,5 +382,6 @@ namespace cpp_cad
             return res;
         }    };
 }
+}
 
 #endif // _CPP_CAD_AFF_TRANSFORMATION_3_H
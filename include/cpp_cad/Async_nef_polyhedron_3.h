@@ -0,0 +1,272 @@
+#ifndef _CPP_CAD_ASYNC_NEF_POLYHEDRON_3_H
+#define _CPP_CAD_ASYNC_NEF_POLYHEDRON_3_H
+
+#include <cmath>
+#include <future>
+#include <string>
+
+#include "Aff_transformation_3.h"
+#include "Nef_polyhedron_3.h"
+#include "Polygon_2.h"
+#include "reference_frame.h"
+#include "WorkerPool.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+    // A handle to a solid that's being constructed on a worker pool.
+    //     Factories, transforms and boolean operations return at once, and
+    // run as pool tasks, which wait for their operands.  So the
+    // constructions of independent parts run concurrently, while the
+    // caller keeps building the scene.  Each task computes the same solid,
+    // as the equivalent Nef_polyhedron_3 code, so results don't depend on
+    // the pool's worker count.
+    class Async_nef_polyhedron_3
+    {
+        private:
+
+        WorkerPool::Future<Nef_polyhedron_3> future;
+        WorkerPool *pool;
+
+        Async_nef_polyhedron_3(
+            WorkerPool::Future<Nef_polyhedron_3> future, WorkerPool &pool)
+        : future(future),
+            pool(&pool)
+        {}
+
+        // Updates the state that Nef_polyhedron_3 computes lazily (pending
+        // transforms, and the bounding box), since tasks that share the
+        // solid would otherwise update it concurrently.
+        static Nef_polyhedron_3 settled(Nef_polyhedron_3 solid)
+        {
+            solid.apply_pending_transformation();
+            solid.bbox();
+
+            return solid;
+        }
+
+        template <class Function>
+        static Async_nef_polyhedron_3 submit(
+            WorkerPool &pool, Function function)
+        {
+            return Async_nef_polyhedron_3(pool.submit(
+                [function]() -> Nef_polyhedron_3
+                {
+                    return settled(function());
+                }), pool);
+        }
+
+        public:
+
+        // Constructs an empty solid.
+        Async_nef_polyhedron_3(WorkerPool &pool = WorkerPool::shared())
+        : Async_nef_polyhedron_3(
+            Nef_polyhedron_3(Nef_polyhedron_3::EMPTY), pool)
+        {}
+
+        // Wraps an already constructed solid.
+        Async_nef_polyhedron_3(
+            const Nef_polyhedron_3 &solid,
+            WorkerPool &pool = WorkerPool::shared())
+        : pool(&pool)
+        {
+            std::promise<Nef_polyhedron_3> res;
+
+            res.set_value(settled(solid));
+            future = WorkerPool::Future<Nef_polyhedron_3>(
+                res.get_future().share(), pool);
+        }
+
+        // Runs a function that constructs a solid on the pool.
+        template <class Function>
+        static Async_nef_polyhedron_3 run(
+            Function function, WorkerPool &pool = WorkerPool::shared())
+        {
+            return submit(pool, function);
+        }
+
+        static Async_nef_polyhedron_3 make_cube(
+            Coordinate x_length, Coordinate y_length, Coordinate z_length,
+            WorkerPool &pool = WorkerPool::shared())
+        {
+            return submit(pool, [x_length, y_length, z_length]()
+                {
+                    return Nef_polyhedron_3::make_cube(
+                        x_length, y_length, z_length);
+                });
+        }
+
+        static Async_nef_polyhedron_3 make_cylinder(
+            Coordinate base_r = 1, Coordinate top_r = 1, Coordinate height = 1,
+            int linear_subdivision_c = 2,
+            WorkerPool &pool = WorkerPool::shared())
+        {
+            return submit(pool,
+                [base_r, top_r, height, linear_subdivision_c]()
+                {
+                    return Nef_polyhedron_3::make_cylinder(
+                        base_r, top_r, height, linear_subdivision_c);
+                });
+        }
+
+        static Async_nef_polyhedron_3 make_sphere(
+            Coordinate circumsphere_r = 1, int linear_subdivision_c = 2,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE,
+            WorkerPool &pool = WorkerPool::shared())
+        {
+            return submit(pool,
+                [circumsphere_r, linear_subdivision_c, tessalation]()
+                {
+                    return Nef_polyhedron_3::make_sphere(
+                        circumsphere_r, linear_subdivision_c, tessalation);
+                });
+        }
+
+        static Async_nef_polyhedron_3 linear_extrude(
+            const Polygon_2 &polygon, Kernel::FT height,
+            WorkerPool &pool = WorkerPool::shared())
+        {
+            return submit(pool, [polygon, height]() -> Nef_polyhedron_3
+                {
+                    Polygon_2 profile(polygon);
+
+                    return profile.linear_extrude(height);
+                });
+        }
+
+        static Async_nef_polyhedron_3 rotate_extrude(
+            const Polygon_2 &polygon, double angle = 2 * M_PI,
+            int subdivision_c = 16, WorkerPool &pool = WorkerPool::shared())
+        {
+            return submit(pool,
+                [polygon, angle, subdivision_c]() -> Nef_polyhedron_3
+                {
+                    Polygon_2 profile(polygon);
+
+                    return profile.rotate_extrude(angle, subdivision_c);
+                });
+        }
+
+        inline bool is_ready() const
+        {
+            return future.is_ready();
+        }
+
+        // Waits for the solid, running queued pool tasks in the meantime.
+        inline const Nef_polyhedron_3 &get() const
+        {
+            return future.get();
+        }
+
+        Async_nef_polyhedron_3 &transform(
+            const Aff_transformation_3 &transformation)
+        {
+            WorkerPool::Future<Nef_polyhedron_3> source = future;
+
+            *this = submit(*pool,
+                [source, transformation]() -> Nef_polyhedron_3
+                {
+                    Nef_polyhedron_3 res = source.get();
+
+                    res.transform(transformation);
+
+                    return res;
+                });
+
+            return *this;
+        }
+
+        Async_nef_polyhedron_3 &translate(
+            Kernel::FT x, Kernel::FT y, Kernel::FT z)
+        {
+            return transform(Aff_transformation_3::translate(x, y, z));
+        }
+
+        Async_nef_polyhedron_3 &rotate_x(double angle)
+        {
+            return transform(Aff_transformation_3::rotate_x(angle));
+        }
+
+        Async_nef_polyhedron_3 &rotate_y(double angle)
+        {
+            return transform(Aff_transformation_3::rotate_y(angle));
+        }
+
+        Async_nef_polyhedron_3 &rotate_z(double angle)
+        {
+            return transform(Aff_transformation_3::rotate_z(angle));
+        }
+
+        Async_nef_polyhedron_3 operator+(
+            const Async_nef_polyhedron_3 &rhs) const
+        {
+            WorkerPool::Future<Nef_polyhedron_3> lhs_source = future;
+            WorkerPool::Future<Nef_polyhedron_3> rhs_source = rhs.future;
+
+            return submit(*pool, [lhs_source, rhs_source]()
+                {
+                    return lhs_source.get() + rhs_source.get();
+                });
+        }
+
+        Async_nef_polyhedron_3 operator-(
+            const Async_nef_polyhedron_3 &rhs) const
+        {
+            WorkerPool::Future<Nef_polyhedron_3> lhs_source = future;
+            WorkerPool::Future<Nef_polyhedron_3> rhs_source = rhs.future;
+
+            return submit(*pool, [lhs_source, rhs_source]()
+                {
+                    return lhs_source.get() - rhs_source.get();
+                });
+        }
+
+        Async_nef_polyhedron_3 operator*(
+            const Async_nef_polyhedron_3 &rhs) const
+        {
+            WorkerPool::Future<Nef_polyhedron_3> lhs_source = future;
+            WorkerPool::Future<Nef_polyhedron_3> rhs_source = rhs.future;
+
+            return submit(*pool, [lhs_source, rhs_source]()
+                {
+                    return lhs_source.get() * rhs_source.get();
+                });
+        }
+
+        Async_nef_polyhedron_3 &operator+=(const Async_nef_polyhedron_3 &rhs)
+        {
+            *this = *this + rhs;
+
+            return *this;
+        }
+
+        Async_nef_polyhedron_3 &operator-=(const Async_nef_polyhedron_3 &rhs)
+        {
+            *this = *this - rhs;
+
+            return *this;
+        }
+
+        Async_nef_polyhedron_3 &operator*=(const Async_nef_polyhedron_3 &rhs)
+        {
+            *this = *this * rhs;
+
+            return *this;
+        }
+
+        void write_to_obj_file(std::string path) const
+        {
+            Nef_polyhedron_3 solid = get();
+
+            solid.write_to_obj_file(path);
+        }
+    };
+
+}
+}
+
+#endif // _CPP_CAD_ASYNC_NEF_POLYHEDRON_3_H
@@ -0,0 +1,94 @@
+#ifndef _CPP_CAD_INDEXED_MESH_H
+#define _CPP_CAD_INDEXED_MESH_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+
+namespace cpp_cad
+{
+
+// A view of a mesh in flat arrays, as generated by other tools.  The arrays
+// aren't copied, so they must outlive the view.
+//     Face `i` has the vertices `indices[face_offsets[i]]` to
+// `indices[face_offsets[i + 1] - 1]`, counterclockwise, when seen from
+// outside the solid.  Builders `validate()` the view before adding it.
+struct IndexedMesh
+{
+    // The x, y, and z coordinates of each vertex:
+    const double *coordinates;
+    std::size_t vertex_count;
+    // The vertex indices of all faces, one face after the other:
+    const std::size_t *indices;
+    // `face_count + 1` offsets into `indices`:
+    const std::size_t *face_offsets;
+    std::size_t face_count;
+
+    IndexedMesh(
+        const double *coordinates, std::size_t vertex_count,
+        const std::size_t *indices,
+        const std::size_t *face_offsets, std::size_t face_count)
+    : coordinates(coordinates),
+        vertex_count(vertex_count),
+        indices(indices),
+        face_offsets(face_offsets),
+        face_count(face_count)
+    {}
+
+    IndexedMesh(
+        const std::vector<double> &coordinates,
+        const std::vector<std::size_t> &indices,
+        const std::vector<std::size_t> &face_offsets)
+    : coordinates(coordinates.data()),
+        vertex_count(coordinates.size() / 3),
+        indices(indices.data()),
+        face_offsets(face_offsets.data()),
+        face_count(face_offsets.empty() ? 0 : face_offsets.size() - 1)
+    {
+        if (coordinates.size() % 3 != 0)
+        {
+            throw std::invalid_argument(
+                "Indexed mesh coordinates must come in triples.");
+        }
+
+        if (face_count > 0 && face_offsets[face_count] > indices.size())
+        {
+            throw std::invalid_argument(
+                "Indexed mesh face offsets must be within the indices.");
+        }
+    }
+
+    inline std::size_t index_count() const
+    {
+        return face_count == 0 ? 0 : face_offsets[face_count] - face_offsets[0];
+    }
+
+    // Throws `std::invalid_argument`, unless the face offsets increase by,
+    // at least, 3 vertices per face, and all indices refer to vertices.
+    void validate() const
+    {
+        for (std::size_t face_i = 0; face_i < face_count; ++face_i)
+        {
+            if (face_offsets[face_i + 1] < face_offsets[face_i] ||
+                face_offsets[face_i + 1] - face_offsets[face_i] < 3)
+            {
+                throw std::invalid_argument(
+                    "Indexed mesh faces must have, at least, 3 vertices.");
+            }
+        }
+
+        for (std::size_t index_i = 0; index_i < index_count(); ++index_i)
+        {
+            if (indices[face_offsets[0] + index_i] >= vertex_count)
+            {
+                throw std::invalid_argument(
+                    "Indexed mesh indices must refer to its vertices.");
+            }
+        }
+    }
+};
+
+}
+
+#endif // _CPP_CAD_INDEXED_MESH_H
@@ -0,0 +1,779 @@
+#ifndef _CPP_CAD_LAZY_NEF_POLYHEDRON_3_H
+#define _CPP_CAD_LAZY_NEF_POLYHEDRON_3_H
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Aff_transformation_3.h"
+#include "Nef_polyhedron_3.h"
+#include "Polygon_2.h"
+#include "reference_frame.h"
+#include "SolidCache.h"
+#include "WorkerPool.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+    // A handle to a solid that records how the solid is constructed, instead
+    // of constructing it.
+    //     Primitives, transforms and boolean operations form a directed
+    // acyclic graph, which is only evaluated by `evaluate()`, or
+    // `write_to_obj_file()`.  Consecutive transforms are folded into one,
+    // transformed primitives are built in place, empty operands are dropped,
+    // and unions are merged in a balanced tree, smallest operands first.
+    // Independent subgraphs are evaluated concurrently.
+    //     Each node has a structural hash of its operation, parameters, and
+    // operand hashes.  Nodes with equal hashes are evaluated once, and
+    // evaluated solids are memoized in SolidCache::shared(), when it's
+    // enabled.  Solids built only from primitives can also be kept in the
+    // cache's directory across processes.  Wrapped solids get per-process
+    // ids, so subgraphs that contain them are only cached in memory.
+    class Lazy_nef_polyhedron_3
+    {
+        public:
+
+        enum Operation
+        {
+            EMPTY,
+            // An already evaluated solid:
+            SOLID,
+            PRIMITIVE,
+            TRANSFORM,
+            UNION,
+            DIFFERENCE,
+            INTERSECTION
+        };
+
+        private:
+
+        struct Node
+        {
+            Operation operation;
+            // The solid of a SOLID node:
+            Nef_polyhedron_3 solid;
+            // Constructs the solid of a PRIMITIVE node, placed by a
+            // transformation, if it's not null:
+            std::function<Nef_polyhedron_3(const Aff_transformation_3 *)>
+                make_primitive;
+            // The transformation of a TRANSFORM node:
+            Aff_transformation_3 transformation;
+            std::vector<std::shared_ptr<const Node>> operands;
+            // Number of SOLID and PRIMITIVE nodes in the subgraph:
+            std::size_t leaf_count;
+            StructuralHash hash;
+            // Whether the hash identifies the same solid in other processes,
+            // i.e. the subgraph has no SOLID nodes:
+            bool is_persistent;
+
+            Node(Operation operation)
+            : operation(operation),
+                leaf_count(operation == SOLID || operation == PRIMITIVE ? 1 : 0),
+                hash(),
+                is_persistent(operation != SOLID)
+            {}
+        };
+
+        typedef std::shared_ptr<const Node> NodePtr;
+
+        // Schedules the nodes of a graph in levels of independent steps, and
+        // evaluates them.
+        class Evaluator
+        {
+            private:
+
+            struct Step
+            {
+                Operation operation;
+                const Node *node;
+                std::vector<std::size_t> operands;
+                std::size_t level;
+                StructuralHash hash;
+                bool is_persistent;
+                // The memoized solid, if the step was found in the cache:
+                SolidCache::SolidPtr cached_solid;
+            };
+
+            typedef std::unordered_map<
+                StructuralHash, std::size_t, StructuralHash::Hasher> HashSteps;
+
+            SolidCache &cache;
+            std::vector<Step> steps;
+            HashSteps hash_steps;
+
+            public:
+
+            Evaluator(SolidCache &cache)
+            : cache(cache)
+            {}
+
+            // Adds the steps that evaluate a node, and returns the index of
+            // the step that computes its solid.
+            std::size_t add_node(const Node &node)
+            {
+                HashSteps::const_iterator found = hash_steps.find(node.hash);
+
+                if (found != hash_steps.end())
+                {
+                    return found->second;
+                }
+
+                std::size_t res;
+                SolidCache::SolidPtr cached_solid =
+                    cache.find(node.hash, node.is_persistent);
+
+                if (cached_solid)
+                {
+                    // The subgraph needn't be evaluated:
+                    res = add_step(SOLID, node, {}, node.hash, node.is_persistent);
+                    steps[res].cached_solid = cached_solid;
+                }
+                else if (node.operation == UNION)
+                {
+                    // Merge operands of similar size with each other:
+                    std::vector<NodePtr> operands(node.operands);
+
+                    std::stable_sort(operands.begin(), operands.end(),
+                        [](const NodePtr &lhs, const NodePtr &rhs)
+                        {
+                            return lhs->leaf_count < rhs->leaf_count;
+                        });
+
+                    std::vector<std::size_t> level;
+
+                    for (const NodePtr &operand : operands)
+                    {
+                        level.push_back(add_node(*operand));
+                    }
+
+                    res = add_balanced_union(level, node);
+                }
+                else if (node.operation == TRANSFORM &&
+                    node.operands.front()->operation == PRIMITIVE)
+                {
+                    // Transforming the primitive's vertices is cheaper than
+                    // transforming its solid:
+                    res = add_step(
+                        TRANSFORM, node, {}, node.hash, node.is_persistent);
+                }
+                else
+                {
+                    std::vector<std::size_t> operand_steps;
+
+                    for (const NodePtr &operand : node.operands)
+                    {
+                        operand_steps.push_back(add_node(*operand));
+                    }
+
+                    res = add_step(
+                        node.operation, node, operand_steps, node.hash,
+                        node.is_persistent);
+                }
+
+                hash_steps[node.hash] = res;
+
+                return res;
+            }
+
+            // Evaluates the steps up to the one with the given index.
+            Nef_polyhedron_3 run(std::size_t root, WorkerPool &pool)
+            {
+                std::vector<std::vector<std::size_t>> levels;
+                std::vector<std::size_t> consumer_counts(steps.size(), 0);
+
+                for (std::size_t i = 0; i <= root; ++i)
+                {
+                    if (steps[i].level >= levels.size())
+                    {
+                        levels.resize(steps[i].level + 1);
+                    }
+                    levels[steps[i].level].push_back(i);
+
+                    for (std::size_t operand : steps[i].operands)
+                    {
+                        ++consumer_counts[operand];
+                    }
+                }
+
+                std::vector<Nef_polyhedron_3> results(steps.size());
+
+                for (const std::vector<std::size_t> &level : levels)
+                {
+                    std::vector<WorkerPool::Future<void>> tasks;
+                    // The tasks refer to `results`:
+                    WorkerPool::WaitGuard<void> tasks_guard(tasks);
+
+                    tasks.reserve(level.size());
+                    for (std::size_t i : level)
+                    {
+                        tasks.push_back(pool.submit([this, &results, i]()
+                            {
+                                const Step &step = steps[i];
+
+                                if (step.cached_solid)
+                                {
+                                    results[i] = *step.cached_solid;
+                                }
+                                else
+                                {
+                                    results[i] = evaluate_step(step, results);
+
+                                    if (step.operation != SOLID &&
+                                        step.operation != EMPTY)
+                                    {
+                                        cache.insert(step.hash, results[i],
+                                            step.is_persistent);
+                                    }
+                                }
+                            }));
+                    }
+
+                    for (const WorkerPool::Future<void> &task : tasks)
+                    {
+                        task.get();
+                    }
+
+                    // Release intermediate solids that are no longer needed:
+                    for (std::size_t i : level)
+                    {
+                        for (std::size_t operand : steps[i].operands)
+                        {
+                            if (--consumer_counts[operand] == 0)
+                            {
+                                results[operand] =
+                                    Nef_polyhedron_3(Nef_polyhedron_3::EMPTY);
+                            }
+                        }
+                    }
+                }
+
+                return results[root];
+            }
+
+            private:
+
+            std::size_t add_step(
+                Operation operation, const Node &node,
+                const std::vector<std::size_t> &operands, StructuralHash hash,
+                bool is_persistent)
+            {
+                Step step;
+
+                step.operation = operation;
+                step.node = &node;
+                step.operands = operands;
+                step.hash = hash;
+                step.is_persistent = is_persistent;
+                step.level = 0;
+                for (std::size_t operand : operands)
+                {
+                    step.level = std::max(step.level, steps[operand].level + 1);
+                }
+
+                steps.push_back(step);
+
+                return steps.size() - 1;
+            }
+
+            std::size_t add_balanced_union(
+                std::vector<std::size_t> level, const Node &node)
+            {
+                while (level.size() > 1)
+                {
+                    std::vector<std::size_t> next_level;
+
+                    for (std::size_t i = 0; i + 1 < level.size(); i += 2)
+                    {
+                        // The last merge computes the whole union:
+                        StructuralHash hash = level.size() == 2 ?
+                            node.hash :
+                            commutative_hash("union",
+                                steps[level[i]].hash, steps[level[i + 1]].hash);
+
+                        next_level.push_back(add_step(
+                            UNION, node, { level[i], level[i + 1] }, hash,
+                            steps[level[i]].is_persistent &&
+                                steps[level[i + 1]].is_persistent));
+                    }
+
+                    if (level.size() % 2 != 0)
+                    {
+                        next_level.push_back(level.back());
+                    }
+
+                    level.swap(next_level);
+                }
+
+                return level.front();
+            }
+
+            static Nef_polyhedron_3 evaluate_step(
+                const Step &step, const std::vector<Nef_polyhedron_3> &results)
+            {
+                switch (step.operation)
+                {
+                    case SOLID:
+                        return step.node->solid;
+
+                    case PRIMITIVE:
+                        return step.node->make_primitive(nullptr);
+
+                    case TRANSFORM:
+                    {
+                        if (step.operands.empty())
+                        {
+                            // A placed primitive:
+                            return step.node->operands.front()->make_primitive(
+                                &step.node->transformation);
+                        }
+
+                        Nef_polyhedron_3 res = results[step.operands[0]];
+
+                        res.transform(step.node->transformation);
+                        // The result may be shared by several steps:
+                        res.apply_pending_transformation();
+
+                        return res;
+                    }
+
+                    case UNION:
+                        return results[step.operands[0]] +
+                            results[step.operands[1]];
+
+                    case DIFFERENCE:
+                        return results[step.operands[0]] -
+                            results[step.operands[1]];
+
+                    case INTERSECTION:
+                        return results[step.operands[0]] *
+                            results[step.operands[1]];
+
+                    case EMPTY:
+                    default:
+                        return Nef_polyhedron_3(Nef_polyhedron_3::EMPTY);
+                }
+            }
+        };
+
+        NodePtr node;
+
+        Lazy_nef_polyhedron_3(NodePtr node)
+        : node(node)
+        {}
+
+        // Returns the hash of an operation, whose operands can be reordered.
+        static StructuralHash commutative_hash(
+            const std::string &operation,
+            std::vector<StructuralHash> operand_hashes)
+        {
+            std::sort(operand_hashes.begin(), operand_hashes.end());
+
+            StructuralKey key(operation);
+
+            for (StructuralHash operand_hash : operand_hashes)
+            {
+                key.add(operand_hash);
+            }
+
+            return key.hash();
+        }
+
+        static StructuralHash commutative_hash(
+            const std::string &operation,
+            StructuralHash lhs_hash, StructuralHash rhs_hash)
+        {
+            return commutative_hash(operation, { lhs_hash, rhs_hash });
+        }
+
+        static Lazy_nef_polyhedron_3 make_primitive(
+            const StructuralKey &key,
+            std::function<Nef_polyhedron_3(const Aff_transformation_3 *)>
+                make_solid)
+        {
+            std::shared_ptr<Node> res = std::make_shared<Node>(PRIMITIVE);
+
+            res->make_primitive = make_solid;
+            res->hash = key.hash();
+
+            return Lazy_nef_polyhedron_3(res);
+        }
+
+        static Lazy_nef_polyhedron_3 make_binary_operation(
+            Operation operation,
+            const NodePtr &lhs, const NodePtr &rhs)
+        {
+            std::shared_ptr<Node> res = std::make_shared<Node>(operation);
+
+            res->operands.push_back(lhs);
+            res->operands.push_back(rhs);
+            res->leaf_count = lhs->leaf_count + rhs->leaf_count;
+            res->is_persistent = lhs->is_persistent && rhs->is_persistent;
+
+            if (operation == INTERSECTION)
+            {
+                res->hash = commutative_hash("intersection", lhs->hash, rhs->hash);
+            }
+            else
+            {
+                res->hash = StructuralKey("difference")
+                    .add(lhs->hash).add(rhs->hash).hash();
+            }
+
+            return Lazy_nef_polyhedron_3(res);
+        }
+
+        // Adds an operand to a union node, flattening nested unions:
+        static void add_union_operand(Node &res, const NodePtr &operand)
+        {
+            if (operand->operation == UNION)
+            {
+                res.operands.insert(res.operands.end(),
+                    operand->operands.begin(), operand->operands.end());
+            }
+            else
+            {
+                res.operands.push_back(operand);
+            }
+
+            res.leaf_count += operand->leaf_count;
+            res.is_persistent = res.is_persistent && operand->is_persistent;
+        }
+
+        public:
+
+        // Constructs an empty solid.
+        Lazy_nef_polyhedron_3()
+        {
+            std::shared_ptr<Node> res = std::make_shared<Node>(EMPTY);
+
+            res->hash = StructuralKey("empty").hash();
+            node = res;
+        }
+
+        // Wraps an already evaluated solid.
+        Lazy_nef_polyhedron_3(const Nef_polyhedron_3 &solid)
+        {
+            // There's no recipe to hash, so give each solid a unique id:
+            static std::atomic<unsigned long> solid_id(0);
+
+            std::shared_ptr<Node> res =
+                std::make_shared<Node>(solid.is_empty() ? EMPTY : SOLID);
+
+            res->solid = solid;
+            // Steps share the solid between threads:
+            res->solid.apply_pending_transformation();
+            res->hash = solid.is_empty() ?
+                StructuralKey("empty").hash() :
+                StructuralKey("solid").add(solid_id++).hash();
+            node = res;
+        }
+
+        static Lazy_nef_polyhedron_3 make_cube(
+            Coordinate x_length, Coordinate y_length, Coordinate z_length)
+        {
+            StructuralKey key("cube");
+
+            key.add(x_length).add(y_length).add(z_length);
+
+            return make_primitive(key, [x_length, y_length, z_length](
+                    const Aff_transformation_3 *placement) -> Nef_polyhedron_3
+                {
+                    if (placement != nullptr)
+                    {
+                        return Nef_polyhedron_3::make_cube(
+                            x_length, y_length, z_length, *placement);
+                    }
+
+                    return Nef_polyhedron_3::make_cube(
+                        x_length, y_length, z_length);
+                });
+        }
+
+        static Lazy_nef_polyhedron_3 make_cylinder(
+            Coordinate base_r = 1, Coordinate top_r = 1, Coordinate height = 1,
+            int linear_subdivision_c = 2)
+        {
+            StructuralKey key("cylinder");
+
+            key.add(base_r).add(top_r).add(height).add(linear_subdivision_c);
+
+            return make_primitive(key,
+                [base_r, top_r, height, linear_subdivision_c](
+                    const Aff_transformation_3 *placement) -> Nef_polyhedron_3
+                {
+                    if (placement != nullptr)
+                    {
+                        return Nef_polyhedron_3::make_cylinder(
+                            base_r, top_r, height, linear_subdivision_c,
+                            *placement);
+                    }
+
+                    return Nef_polyhedron_3::make_cylinder(
+                        base_r, top_r, height, linear_subdivision_c);
+                });
+        }
+
+        static Lazy_nef_polyhedron_3 make_sphere(
+            Coordinate circumsphere_r = 1, int linear_subdivision_c = 2,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            StructuralKey key("sphere");
+
+            key.add(circumsphere_r).add(linear_subdivision_c)
+                .add(static_cast<int>(tessalation));
+
+            return make_primitive(key,
+                [circumsphere_r, linear_subdivision_c, tessalation](
+                    const Aff_transformation_3 *placement) -> Nef_polyhedron_3
+                {
+                    if (placement != nullptr)
+                    {
+                        return Nef_polyhedron_3::make_sphere(
+                            circumsphere_r, linear_subdivision_c, *placement,
+                            tessalation);
+                    }
+
+                    return Nef_polyhedron_3::make_sphere(
+                        circumsphere_r, linear_subdivision_c, tessalation);
+                });
+        }
+
+        static Lazy_nef_polyhedron_3 linear_extrude(
+            const Polygon_2 &polygon, Kernel::FT height)
+        {
+            StructuralKey key("linear_extrude");
+
+            key.add(polygon).add(height);
+
+            return make_primitive(key, [polygon, height](
+                    const Aff_transformation_3 *placement) -> Nef_polyhedron_3
+                {
+                    Polygon_2 profile(polygon);
+
+                    if (placement != nullptr)
+                    {
+                        return profile.linear_extrude(height, *placement);
+                    }
+
+                    return profile.linear_extrude(height);
+                });
+        }
+
+        static Lazy_nef_polyhedron_3 rotate_extrude(
+            const Polygon_2 &polygon, double angle = 2 * M_PI,
+            int subdivision_c = 16)
+        {
+            StructuralKey key("rotate_extrude");
+
+            key.add(polygon).add(angle).add(subdivision_c);
+
+            return make_primitive(key,
+                [polygon, angle, subdivision_c](
+                    const Aff_transformation_3 *placement) -> Nef_polyhedron_3
+                {
+                    Polygon_2 profile(polygon);
+
+                    if (placement != nullptr)
+                    {
+                        return profile.rotate_extrude(
+                            angle, subdivision_c, *placement);
+                    }
+
+                    return profile.rotate_extrude(angle, subdivision_c);
+                });
+        }
+
+        inline Operation operation() const
+        {
+            return node->operation;
+        }
+
+        inline bool is_empty() const
+        {
+            return node->operation == EMPTY;
+        }
+
+        Lazy_nef_polyhedron_3 &transform(
+            const Aff_transformation_3 &transformation)
+        {
+            if (node->operation == EMPTY)
+            {
+                return *this;
+            }
+
+            std::shared_ptr<Node> res = std::make_shared<Node>(TRANSFORM);
+
+            if (node->operation == TRANSFORM)
+            {
+                // Fold consecutive transforms into one:
+                res->transformation = transformation * node->transformation;
+                res->operands = node->operands;
+            }
+            else
+            {
+                res->transformation = transformation;
+                res->operands.push_back(node);
+            }
+            res->leaf_count = node->leaf_count;
+            res->is_persistent = node->is_persistent;
+            res->hash = StructuralKey("transform")
+                .add(res->transformation).add(res->operands.front()->hash)
+                .hash();
+            node = res;
+
+            return *this;
+        }
+
+        Lazy_nef_polyhedron_3 &translate(Kernel::FT x, Kernel::FT y, Kernel::FT z)
+        {
+            return transform(cpp_cad::Aff_transformation_3::translate(x, y, z));
+        }
+
+        Lazy_nef_polyhedron_3 &rotate_x(double angle)
+        {
+            return transform(cpp_cad::Aff_transformation_3::rotate_x(angle));
+        }
+
+        Lazy_nef_polyhedron_3 &rotate_y(double angle)
+        {
+            return transform(cpp_cad::Aff_transformation_3::rotate_y(angle));
+        }
+
+        Lazy_nef_polyhedron_3 &rotate_z(double angle)
+        {
+            return transform(cpp_cad::Aff_transformation_3::rotate_z(angle));
+        }
+
+        Lazy_nef_polyhedron_3 &rational_rotate_x(
+            double angle,
+            double tolerance = Aff_transformation_3::rational_rotation_tolerance)
+        {
+            return transform(
+                cpp_cad::Aff_transformation_3::rational_rotate_x(angle, tolerance));
+        }
+
+        Lazy_nef_polyhedron_3 &rational_rotate_y(
+            double angle,
+            double tolerance = Aff_transformation_3::rational_rotation_tolerance)
+        {
+            return transform(
+                cpp_cad::Aff_transformation_3::rational_rotate_y(angle, tolerance));
+        }
+
+        Lazy_nef_polyhedron_3 &rational_rotate_z(
+            double angle,
+            double tolerance = Aff_transformation_3::rational_rotation_tolerance)
+        {
+            return transform(
+                cpp_cad::Aff_transformation_3::rational_rotate_z(angle, tolerance));
+        }
+
+        Lazy_nef_polyhedron_3 operator+(const Lazy_nef_polyhedron_3 &rhs) const
+        {
+            if (is_empty())
+            {
+                return rhs;
+            }
+
+            if (rhs.is_empty())
+            {
+                return *this;
+            }
+
+            std::shared_ptr<Node> res = std::make_shared<Node>(UNION);
+
+            add_union_operand(*res, node);
+            add_union_operand(*res, rhs.node);
+
+            std::vector<StructuralHash> operand_hashes;
+
+            for (const NodePtr &operand : res->operands)
+            {
+                operand_hashes.push_back(operand->hash);
+            }
+            res->hash = commutative_hash("union", operand_hashes);
+
+            return Lazy_nef_polyhedron_3(res);
+        }
+
+        Lazy_nef_polyhedron_3 operator-(const Lazy_nef_polyhedron_3 &rhs) const
+        {
+            if (is_empty() || rhs.is_empty())
+            {
+                return *this;
+            }
+
+            return make_binary_operation(DIFFERENCE, node, rhs.node);
+        }
+
+        Lazy_nef_polyhedron_3 operator*(const Lazy_nef_polyhedron_3 &rhs) const
+        {
+            if (is_empty())
+            {
+                return *this;
+            }
+
+            if (rhs.is_empty())
+            {
+                return rhs;
+            }
+
+            return make_binary_operation(INTERSECTION, node, rhs.node);
+        }
+
+        Lazy_nef_polyhedron_3 &operator+=(const Lazy_nef_polyhedron_3 &rhs)
+        {
+            *this = *this + rhs;
+
+            return *this;
+        }
+
+        Lazy_nef_polyhedron_3 &operator-=(const Lazy_nef_polyhedron_3 &rhs)
+        {
+            *this = *this - rhs;
+
+            return *this;
+        }
+
+        Lazy_nef_polyhedron_3 &operator*=(const Lazy_nef_polyhedron_3 &rhs)
+        {
+            *this = *this * rhs;
+
+            return *this;
+        }
+
+        inline StructuralHash hash() const
+        {
+            return node->hash;
+        }
+
+        // Constructs the solid.
+        Nef_polyhedron_3 evaluate(
+            WorkerPool &pool = WorkerPool::shared(),
+            SolidCache &cache = SolidCache::shared()) const
+        {
+            Evaluator evaluator(cache);
+            std::size_t root = evaluator.add_node(*node);
+
+            return evaluator.run(root, pool);
+        }
+
+        void write_to_obj_file(std::string path) const
+        {
+            evaluate().write_to_obj_file(path);
+        }
+    };
+
+}
+}
+
+#endif // _CPP_CAD_LAZY_NEF_POLYHEDRON_3_H
@@ -1,57 +1,416 @@
 #ifndef _CPP_CAD_NEF_POLYHEDRON_3_H
 #define _CPP_CAD_NEF_POLYHEDRON_3_H
 
+#include <atomic>
+#include <cstddef>
 #include <fstream>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <utility>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
 
 #include <CGAL/Aff_transformation_3.h>
+#include <CGAL/Bbox_3.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/IO/Nef_polyhedron_iostream_3.h>
 #include <CGAL/IO/print_wavefront.h>
 #include <CGAL/Nef_polyhedron_3.h>
 
 #include "Aff_transformation_3.h"
+#include "Profiler.h"
 #include "reference_frame.h"
+#include "simplification.h"
+#include "snap_rounding.h"
+#include "Surface_mesh_3.h"
+#include "TessalationCache.h"
+#include "Polyhedron_3/Cube_3_Builder.h"
+#include "Polyhedron_3/Cylinder_3_TessalationBuilder.h"
+#include "Polyhedron_3/Icosphere_3_TessalationBuilder.h"
+#include "Polyhedron_3/IndexedMeshBuilder.h"
 #include "Polyhedron_3/Polyhedron_3.h"
+#include "Polyhedron_3/Sphere_3_TessalationBuilder.h"
+#include "Polyhedron_3/SurfaceMeshSink.h"
 
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+    // Counts how often boolean operations ran a full overlay of their
+    // operands, and how often they took a fast path, because the operands'
+    // bounding boxes didn't overlap.
+    struct BooleanOperationStatistics
+    {
+        std::atomic<unsigned long> overlay_count;
+        std::atomic<unsigned long> disjoint_union_count;
+        std::atomic<unsigned long> disjoint_difference_count;
+        std::atomic<unsigned long> disjoint_intersection_count;
+
+        BooleanOperationStatistics()
+        : overlay_count(0),
+            disjoint_union_count(0),
+            disjoint_difference_count(0),
+            disjoint_intersection_count(0)
+        {}
+
+        void reset()
+        {
+            overlay_count = 0;
+            disjoint_union_count = 0;
+            disjoint_difference_count = 0;
+            disjoint_intersection_count = 0;
+        }
+
+        void write(std::ostream &out) const
+        {
+            out << "Overlays: " << overlay_count << std::endl <<
+                "Disjoint unions: " << disjoint_union_count << std::endl <<
+                "Disjoint differences: " << disjoint_difference_count << std::endl <<
+                "Disjoint intersections: " << disjoint_intersection_count << std::endl;
+        }
+    };
+
+    // Counts compactions, and approximately the heap bytes they released.
+    struct CompactStatistics
+    {
+        std::atomic<unsigned long> compact_count;
+        // The sum of the changes of the process's heap during the
+        // compactions, so it also counts the allocations of other threads,
+        // and is only approximate.  Negative, if computing the exact values
+        // took more memory than the construction history they replaced.
+        // Only measured with glibc:
+        std::atomic<long long> approximate_reclaimed_byte_count;
+
+        CompactStatistics()
+        : compact_count(0),
+            approximate_reclaimed_byte_count(0)
+        {}
+
+        void reset()
+        {
+            compact_count = 0;
+            approximate_reclaimed_byte_count = 0;
+        }
+
+        void write(std::ostream &out) const
+        {
+            out << "Compactions: " << compact_count << std::endl <<
+                "Approximate reclaimed bytes (process heap): " <<
+                approximate_reclaimed_byte_count << std::endl;
+        }
+    };
+
+    namespace internal
+    {
+
+    // Computes the exact value of a lazy kernel object, which lets the
+    // kernel drop the history of its construction:
+    template <class Value>
+    auto make_exact(const Value &value, int) -> decltype(value.exact(), void())
+    {
+        value.exact();
+    }
+
+    // Other kernels' values are already exact, or never will be:
+    template <class Value>
+    void make_exact(const Value &, long)
+    {}
+
+    // Returns the bytes of heap memory in use by the whole process, or 0,
+    // if unknown.
+    inline std::size_t heap_byte_count()
+    {
+    #if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+        return mallinfo2().uordblks;
+    #elif defined(__GLIBC__)
+        return static_cast<unsigned int>(mallinfo().uordblks);
+    #else
+        return 0;
+    #endif
+    }
+
+    }
 
     class Nef_polyhedron_3 : public CGAL::Nef_polyhedron_3<Kernel>
     {
+        private:
+
+        // The bounding box, computed once, when it's first needed, even if
+        // the solid is shared by several threads.
+        struct BboxCache
+        {
+            std::once_flag computed;
+            CGAL::Bbox_3 bbox;
+        };
+
+        // Copies share the cache, until either is changed, which replaces
+        // its cache:
+        std::shared_ptr<BboxCache> bbox_cache = std::make_shared<BboxCache>();
+
+        // Transforms that haven't been applied to the SNC yet, composed
+        // into one.  Only non-const methods apply them.
+        bool transformation_pending = false;
+        cpp_cad::Aff_transformation_3 pending_transformation;
+
+        // The SNC with the pending transforms applied, computed once, when
+        // a const method first needs it.
+        struct AppliedCache
+        {
+            std::once_flag computed;
+            std::unique_ptr<CGAL::Nef_polyhedron_3<Kernel>> solid;
+        };
+
+        // Copies share the cache, until either is transformed, which
+        // replaces its cache.  Null, if no transforms are pending:
+        std::shared_ptr<AppliedCache> applied_cache;
+
+        // Spacing of the grid that results are rounded to, or 0 to use the
+        // default:
+        Kernel::FT snap_grid = 0;
+
         public:
 
-        inline static Nef_polyhedron_3 make_cube(
-            Coordinate x_length, Coordinate y_length, Coordinate z_length)
+        typedef CGAL::Nef_polyhedron_3<Kernel> CGAL_Nef_polyhedron_3;
+        typedef Surface_mesh_3::Mesh Surface_mesh;
+
+        // Spacing of the grid that results of all solids without their own
+        // grid are rounded to.  0, the default, disables rounding.  Set it
+        // before using solids from several threads.
+        inline static Kernel::FT &default_snap_grid()
         {
-            Polyhedron_3 p;
+            static Kernel::FT res = 0;
+
+            return res;
+        }
+
+        // Boolean operations compact every `compact_interval()`-th result.
+        // 0, the default, disables automatic compaction.  Set it before
+        // using solids from several threads.
+        inline static unsigned long &compact_interval()
+        {
+            static unsigned long res = 0;
+
+            return res;
+        }
+
+        // Boolean operations simplify their results with
+        // `merge_coplanar_facets()`, if set.  Off by default.  Set it before
+        // using solids from several threads.
+        inline static bool &simplify_results()
+        {
+            static bool res = false;
+
+            return res;
+        }
+
+        // The count-based sphere, and cylinder factories copy, and scale
+        // unit solids from `TessalationCache::shared()`, if set, instead of
+        // building, and converting each tessalation.  Scaling is exact, so
+        // a copy has the unit solid's vertices times the radii.  The
+        // builders round each vertex to doubles at the requested radii,
+        // instead, so built vertices may differ from scaled ones in the
+        // last bits.  Off by default, which keeps the built vertices.  Set
+        // it before using solids from several threads.
+        inline static bool &cache_tessalations()
+        {
+            static bool res = false;
+
+            return res;
+        }
+
+        inline static CompactStatistics &compact_statistics()
+        {
+            static CompactStatistics res;
+
+            return res;
+        }
 
-            p.add_cube(x_length, y_length, z_length);
+        inline static BooleanOperationStatistics &boolean_operation_statistics()
+        {
+            static BooleanOperationStatistics res;
 
-            return Nef_polyhedron_3(p);
+            return res;
+        }
+
+        // The factories build primitives into a surface mesh, and convert
+        // it, without building a polyhedron first.
+
+        inline static Nef_polyhedron_3 make_cube(
+            Coordinate x_length, Coordinate y_length, Coordinate z_length)
+        {
+            return build<Cube_3_Builder<Surface_mesh, SurfaceMeshSink>>(
+                nullptr, x_length, y_length, z_length);
         }
 
         inline static Nef_polyhedron_3 make_cylinder(
             Coordinate base_r = 1, Coordinate top_r = 1, Coordinate height = 1,
             int linear_subdivision_c = 2)
         {
-            Polyhedron_3 p;
+            if (cache_tessalations() && height > 0 &&
+                (base_r > 0 || top_r > 0))
+            {
+                return cached_cylinder(
+                    base_r, top_r, height, linear_subdivision_c);
+            }
 
-            p.add_cylindrical_tessalation(base_r, top_r, height, linear_subdivision_c);
+            return build<CylinderBuilder>(
+                nullptr, base_r, top_r, height, linear_subdivision_c);
+        }
 
-            return Nef_polyhedron_3(p);
+        inline static Nef_polyhedron_3 make_sphere(
+            Coordinate circumsphere_r = 1, int linear_subdivision_c = 2,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            if (cache_tessalations() && circumsphere_r > 0)
+            {
+                return cached_sphere(
+                    circumsphere_r, linear_subdivision_c, tessalation);
+            }
+
+            return build_sphere(
+                tessalation, nullptr, circumsphere_r, linear_subdivision_c);
+        }
+
+        // The following factories subdivide curved surfaces as coarsely as
+        // `tolerance` allows.
+
+        inline static Nef_polyhedron_3 make_cylinder(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            const TessalationTolerance &tolerance)
+        {
+            return build<CylinderBuilder>(
+                nullptr, base_r, top_r, height, 0, tolerance);
         }
 
         inline static Nef_polyhedron_3 make_sphere(
-            Coordinate circumsphere_r = 1, int linear_subdivision_c = 2)
+            Coordinate circumsphere_r, const TessalationTolerance &tolerance,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
         {
-            Polyhedron_3 p;
+            return build_sphere(
+                tessalation, nullptr, circumsphere_r, 0, tolerance);
+        }
+
+        // The following factories build the solid already transformed by
+        // `placement`, which is much cheaper than transforming the solid.
+
+        inline static Nef_polyhedron_3 make_cube(
+            Coordinate x_length, Coordinate y_length, Coordinate z_length,
+            const cpp_cad::Aff_transformation_3 &placement)
+        {
+            return build<Cube_3_Builder<Surface_mesh, SurfaceMeshSink>>(
+                &placement, x_length, y_length, z_length);
+        }
+
+        inline static Nef_polyhedron_3 make_cylinder(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            int linear_subdivision_c,
+            const cpp_cad::Aff_transformation_3 &placement)
+        {
+            if (cache_tessalations() && height > 0 &&
+                (base_r > 0 || top_r > 0))
+            {
+                return cached_cylinder(
+                    base_r, top_r, height, linear_subdivision_c)
+                    .transform(placement);
+            }
+
+            return build<CylinderBuilder>(
+                &placement, base_r, top_r, height, linear_subdivision_c);
+        }
+
+        inline static Nef_polyhedron_3 make_sphere(
+            Coordinate circumsphere_r, int linear_subdivision_c,
+            const cpp_cad::Aff_transformation_3 &placement,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            if (cache_tessalations() && circumsphere_r > 0)
+            {
+                return cached_sphere(
+                    circumsphere_r, linear_subdivision_c, tessalation)
+                    .transform(placement);
+            }
+
+            return build_sphere(
+                tessalation, &placement, circumsphere_r, linear_subdivision_c);
+        }
+
+        inline static Nef_polyhedron_3 make_cylinder(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            const TessalationTolerance &tolerance,
+            const cpp_cad::Aff_transformation_3 &placement)
+        {
+            return build<CylinderBuilder>(
+                &placement, base_r, top_r, height, 0, tolerance);
+        }
+
+        inline static Nef_polyhedron_3 make_sphere(
+            Coordinate circumsphere_r, const TessalationTolerance &tolerance,
+            const cpp_cad::Aff_transformation_3 &placement,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            return build_sphere(
+                tessalation, &placement, circumsphere_r, 0, tolerance);
+        }
 
-            p.add_spherical_tessalation(circumsphere_r, linear_subdivision_c);
+        // Converts a mesh in flat arrays, such as one generated by another
+        // tool.  The mesh is built into a surface mesh in one pass, with
+        // storage reserved for all of it.
+        inline static Nef_polyhedron_3 make_indexed_mesh(const IndexedMesh &mesh)
+        {
+            return build<IndexedMeshBuilder<Surface_mesh, SurfaceMeshSink>>(
+                nullptr, mesh);
+        }
 
-            return Nef_polyhedron_3(p);
+        inline static Nef_polyhedron_3 make_indexed_mesh(
+            const IndexedMesh &mesh,
+            const cpp_cad::Aff_transformation_3 &placement)
+        {
+            return build<IndexedMeshBuilder<Surface_mesh, SurfaceMeshSink>>(
+                &placement, mesh);
+        }
+
+        // Builds a solid with a primitive builder, whose halfedge data
+        // structure is a surface mesh, and whose sink is a
+        // `SurfaceMeshSink`.  `args` follow the builder's halfedge data
+        // structure argument.  `placement` may be null.  Throws
+        // `std::invalid_argument`, if the primitive's faces don't form a
+        // manifold surface.
+        template <class Builder, class... Args>
+        static Nef_polyhedron_3 build(
+            const cpp_cad::Aff_transformation_3 *placement, Args &&... args)
+        {
+            Surface_mesh_3 mesh;
+
+            mesh.add<Builder>(placement, std::forward<Args>(args)...);
+
+            return Nef_polyhedron_3(mesh);
         }
 
         using CGAL::Nef_polyhedron_3<Kernel>::Nef_polyhedron_3;
 
+        // Converts a polyhedral surface.
+        Nef_polyhedron_3(CGAL::Polyhedron_3<Kernel> &p)
+            : Nef_polyhedron_3(p, ProfileScope("polyhedron_to_nef"))
+        {}
+
+        // Converts an index-based surface mesh.
+        Nef_polyhedron_3(const Surface_mesh_3 &mesh)
+            : Nef_polyhedron_3(static_cast<const Surface_mesh &>(mesh),
+                ProfileScope("surface_mesh_to_nef"))
+        {}
+
         Nef_polyhedron_3(CGAL::Nef_polyhedron_3<Kernel>::Content space=EMPTY)
             : CGAL::Nef_polyhedron_3<Kernel>(space)
         {}
@@ -64,14 +423,393 @@ namespace cpp_cad
             : CGAL::Nef_polyhedron_3<Kernel>(p)
         {}
 
+        // Returns an axis-aligned box that contains the solid.
+        //     The box is computed from interval approximations of the
+        // vertices, and of the pending transforms, so it never
+        // underestimates the solid, and doesn't apply the transforms.  It's
+        // cached until the solid is changed through this class.  Unbounded
+        // solids have an infinite box.  Several threads may ask for the box
+        // of the same solid at once.
+        const CGAL::Bbox_3 &bbox() const
+        {
+            BboxCache &cache = *bbox_cache;
+
+            std::call_once(cache.computed, [this, &cache]()
+                {
+                    cache.bbox = computed_bbox();
+                });
+
+            return cache.bbox;
+        }
+
+        // Returns an estimate of the bytes used by the solid's SNC items.
+        //     The estimate doesn't include the coordinates' exact number
+        // representations, so it's a lower bound.
+        std::size_t estimated_memory_footprint() const
+        {
+            // Transforms don't change the counts.  Halfedges are also the
+            // vertices of the sphere maps, whose edges, loops, and faces take
+            // most of the memory:
+            return number_of_vertices() * sizeof(Vertex) +
+                number_of_halfedges() * sizeof(Halfedge) +
+                number_of_halffacets() * sizeof(Halffacet) +
+                number_of_volumes() * sizeof(Volume) +
+                snc().number_of_shalfedges() * sizeof(SHalfedge) +
+                snc().number_of_shalfloops() * sizeof(SHalfloop) +
+                snc().number_of_sfaces() * sizeof(SFace);
+        }
+
+        // Returns true, if the bounding boxes of the two solids don't
+        // overlap, which means the solids don't intersect.
+        inline bool is_bbox_disjoint(const Nef_polyhedron_3 &rhs) const
+        {
+            return !CGAL::do_overlap(bbox(), rhs.bbox());
+        }
+
+        Nef_polyhedron_3 operator+(const Nef_polyhedron_3 &rhs) const
+        {
+            ProfileScope profile("union");
+
+            profile.add_input(*this);
+            profile.add_input(rhs);
+
+            if (is_bbox_disjoint(rhs))
+            {
+                ++boolean_operation_statistics().disjoint_union_count;
+
+                return profile.output(
+                    finished_result(disjoint_union(rhs), rhs));
+            }
+
+            ++boolean_operation_statistics().overlay_count;
+
+            return profile.output(finished_result(
+                Nef_polyhedron_3(applied().CGAL_Nef_polyhedron_3::join(
+                    rhs.applied())), rhs));
+        }
+
+        Nef_polyhedron_3 operator-(const Nef_polyhedron_3 &rhs) const
+        {
+            ProfileScope profile("difference");
+
+            profile.add_input(*this);
+            profile.add_input(rhs);
+
+            if (is_bbox_disjoint(rhs))
+            {
+                ++boolean_operation_statistics().disjoint_difference_count;
+
+                return profile.output(*this);
+            }
+
+            ++boolean_operation_statistics().overlay_count;
+
+            return profile.output(finished_result(
+                Nef_polyhedron_3(applied().CGAL_Nef_polyhedron_3::difference(
+                    rhs.applied())), rhs));
+        }
+
+        Nef_polyhedron_3 operator*(const Nef_polyhedron_3 &rhs) const
+        {
+            ProfileScope profile("intersection");
+
+            profile.add_input(*this);
+            profile.add_input(rhs);
+
+            if (is_bbox_disjoint(rhs))
+            {
+                ++boolean_operation_statistics().disjoint_intersection_count;
+
+                return profile.output(Nef_polyhedron_3(EMPTY));
+            }
+
+            ++boolean_operation_statistics().overlay_count;
+
+            return profile.output(finished_result(
+                Nef_polyhedron_3(applied().CGAL_Nef_polyhedron_3::intersection(
+                    rhs.applied())), rhs));
+        }
+
+        Nef_polyhedron_3 &operator+=(const Nef_polyhedron_3 &rhs)
+        {
+            apply_pending_transformation();
+            *this = *this + rhs;
+
+            return *this;
+        }
+
+        Nef_polyhedron_3 &operator-=(const Nef_polyhedron_3 &rhs)
+        {
+            apply_pending_transformation();
+            *this = *this - rhs;
+
+            return *this;
+        }
+
+        Nef_polyhedron_3 &operator*=(const Nef_polyhedron_3 &rhs)
+        {
+            apply_pending_transformation();
+            *this = *this * rhs;
+
+            return *this;
+        }
+
+        // Transforms the solid.
+        //     The transformation is only composed with the pending ones, so a
+        // chain of transforms traverses the SNC once, when the solid is next
+        // used by a non-const method, such as an export, or is wrapped by
+        // `Lazy_nef_polyhedron_3`, or `Async_nef_polyhedron_3`.  Const
+        // methods of this class use a transformed copy, which is computed
+        // once, and shared by the copies of the solid.  The methods
+        // inherited from the CGAL class see the SNC without the pending
+        // transforms.
         Nef_polyhedron_3 &transform(
             cpp_cad::Aff_transformation_3 transformation)
         {
-            CGAL::Nef_polyhedron_3<Kernel>::transform(transformation);
+            if (transformation_pending)
+            {
+                pending_transformation = transformation * pending_transformation;
+            }
+            else
+            {
+                pending_transformation = transformation;
+                transformation_pending = true;
+            }
+            applied_cache = std::make_shared<AppliedCache>();
+            invalidate_bbox();
 
             return *this;
         }
 
+        // Applies the pending transforms to the SNC.
+        //     Call this before using the solid through the CGAL base class.
+        Nef_polyhedron_3 &apply_pending_transformation()
+        {
+            if (transformation_pending)
+            {
+                // Deferred transforms are profiled here, where they cost:
+                ProfileScope profile("transform");
+
+                profile.add_input(*this);
+                CGAL_Nef_polyhedron_3::transform(pending_transformation);
+                pending_transformation = cpp_cad::Aff_transformation_3();
+                transformation_pending = false;
+                applied_cache.reset();
+                snap_to_effective_grid();
+                profile.output(*this);
+            }
+
+            return *this;
+        }
+
+        // Returns a copy of the solid with the pending transforms applied,
+        // and leaves this solid unchanged.  The transformed SNC is computed
+        // once, and shared by later calls, and copies of the solid, so the
+        // copy is cheap, after the first call.  Several threads may ask for
+        // it at once.
+        Nef_polyhedron_3 applied() const
+        {
+            if (!transformation_pending)
+            {
+                return *this;
+            }
+
+            AppliedCache &cache = *applied_cache;
+
+            std::call_once(cache.computed, [this, &cache]()
+                {
+                    Nef_polyhedron_3 res(*this);
+
+                    res.apply_pending_transformation();
+                    cache.solid.reset(new CGAL_Nef_polyhedron_3(res));
+                });
+
+            const CGAL_Nef_polyhedron_3 &solid = *cache.solid;
+            Nef_polyhedron_3 res(solid);
+
+            res.snap_grid = snap_grid;
+
+            return res;
+        }
+
+        inline bool has_pending_transformation() const
+        {
+            return transformation_pending;
+        }
+
+        // Computes the exact values of all points, and planes of the SNC.
+        //     With a lazy exact kernel, every constructed coordinate keeps
+        // the history of its construction, until its exact value is
+        // computed.  Compacting releases the history, so memory use follows
+        // the size of the solid, not the depth of its construction.
+        // Returns approximately the heap bytes released: the change of the
+        // process's heap during the call, which includes the allocations of
+        // other threads.  It's negative, if the exact values took more
+        // memory, or 0, if it can't be measured.
+        long long compact()
+        {
+            apply_pending_transformation();
+
+            std::size_t heap_before = internal::heap_byte_count();
+
+            for (Vertex_const_iterator vit = vertices_begin();
+                vit != vertices_end();
+                ++vit)
+            {
+                internal::make_exact(vit->point(), 0);
+            }
+
+            // Points on the vertices' sphere maps:
+            for (Halfedge_const_iterator eit = halfedges_begin();
+                eit != halfedges_end();
+                ++eit)
+            {
+                internal::make_exact(eit->point(), 0);
+            }
+
+            for (Halffacet_const_iterator fit = halffacets_begin();
+                fit != halffacets_end();
+                ++fit)
+            {
+                internal::make_exact(fit->plane(), 0);
+            }
+
+            // Circles on the vertices' sphere maps:
+            for (SHalfedge_const_iterator sit = shalfedges_begin();
+                sit != shalfedges_end();
+                ++sit)
+            {
+                internal::make_exact(sit->circle(), 0);
+            }
+
+            for (SHalfloop_const_iterator lit = shalfloops_begin();
+                lit != shalfloops_end();
+                ++lit)
+            {
+                internal::make_exact(lit->circle(), 0);
+            }
+
+            long long res = 0;
+
+            if (heap_before != 0)
+            {
+                res = static_cast<long long>(heap_before) -
+                    static_cast<long long>(internal::heap_byte_count());
+            }
+
+            ++compact_statistics().compact_count;
+            compact_statistics().approximate_reclaimed_byte_count += res;
+
+            return res;
+        }
+
+        // Rounds the results of this solid's transforms, and of boolean
+        // operations with it as the left operand, to a grid with the given
+        // spacing.  Rounding bounds the size of the exact coordinates, which
+        // otherwise grows with every operation.  0 uses the default grid.
+        inline void set_snap_grid(const Kernel::FT &grid)
+        {
+            snap_grid = grid;
+        }
+
+        inline const Kernel::FT &get_snap_grid() const
+        {
+            return snap_grid;
+        }
+
+        // Rounds the vertices to the nearest points of a grid with the given
+        // spacing.
+        //     Returns false, and leaves the solid unchanged, if the solid
+        // isn't a 2-manifold, or rounding would collapse a face, or make
+        // the boundary intersect itself.
+        bool snap_to_grid(const Kernel::FT &grid)
+        {
+            apply_pending_transformation();
+
+            if (is_empty())
+            {
+                return true;
+            }
+
+            if (!CGAL_Nef_polyhedron_3::is_simple())
+            {
+                ++snap_rounding_statistics().rejected_count;
+
+                return false;
+            }
+
+            CGAL::Polyhedron_3<Kernel> mesh;
+
+            CGAL_Nef_polyhedron_3::convert_to_polyhedron(mesh);
+
+            if (!internal::snap_to_grid(mesh, grid))
+            {
+                ++snap_rounding_statistics().rejected_count;
+
+                return false;
+            }
+
+            CGAL_Nef_polyhedron_3::operator=(CGAL_Nef_polyhedron_3(mesh));
+            invalidate_bbox();
+            ++snap_rounding_statistics().snap_count;
+
+            return true;
+        }
+
+        // Merges coplanar adjacent facets, and collinear edges.
+        //     CGAL keeps facets merged, except where lower dimensional
+        // leftovers of boolean operations, such as faces shared by the
+        // operands, split them.  The solid is regularized, which removes the
+        // leftovers, and lets CGAL merge the facets.  Returns the facet
+        // counts before and after.
+        SimplificationReport merge_coplanar_facets()
+        {
+            apply_pending_transformation();
+
+            SimplificationReport res(number_of_facets());
+
+            CGAL_Nef_polyhedron_3::operator=(regularization());
+            invalidate_bbox();
+            res.facet_count_after = number_of_facets();
+            simplification_statistics().add(res);
+
+            return res;
+        }
+
+        template <class PolygonMesh>
+        void convert_to_polyhedron(PolygonMesh &res) const
+        {
+            const Nef_polyhedron_3 solid = applied();
+            ProfileScope profile("convert_to_polyhedron");
+
+            profile.add_input(solid);
+            solid.CGAL_Nef_polyhedron_3::convert_to_polyhedron(res);
+            profile.output(res);
+        }
+
+        // Writes the solid in CGAL's format, with the pending transforms
+        // applied.
+        friend std::ostream &operator<<(
+            std::ostream &out, const Nef_polyhedron_3 &solid)
+        {
+            // CGAL's writer takes a non-const solid:
+            CGAL_Nef_polyhedron_3 res(solid.applied());
+
+            return out << res;
+        }
+
+        // Reads a solid in CGAL's format, replacing the solid, and its
+        // pending transforms.
+        friend std::istream &operator>>(std::istream &in, Nef_polyhedron_3 &res)
+        {
+            CGAL_Nef_polyhedron_3 solid;
+
+            in >> solid;
+            res = Nef_polyhedron_3(std::move(solid));
+
+            return in;
+        }
+
         Nef_polyhedron_3 &translate(Kernel::FT x, Kernel::FT y, Kernel::FT z)
         {
             return transform(cpp_cad::Aff_transformation_3::translate(x, y, z));
@@ -92,8 +830,41 @@ namespace cpp_cad
             return transform(cpp_cad::Aff_transformation_3::rotate_z(angle));
         }
 
+        Nef_polyhedron_3 &rational_rotate_x(
+            double angle,
+            double tolerance =
+                cpp_cad::Aff_transformation_3::rational_rotation_tolerance)
+        {
+            return transform(
+                cpp_cad::Aff_transformation_3::rational_rotate_x(angle, tolerance));
+        }
+
+        Nef_polyhedron_3 &rational_rotate_y(
+            double angle,
+            double tolerance =
+                cpp_cad::Aff_transformation_3::rational_rotation_tolerance)
+        {
+            return transform(
+                cpp_cad::Aff_transformation_3::rational_rotate_y(angle, tolerance));
+        }
+
+        Nef_polyhedron_3 &rational_rotate_z(
+            double angle,
+            double tolerance =
+                cpp_cad::Aff_transformation_3::rational_rotation_tolerance)
+        {
+            return transform(
+                cpp_cad::Aff_transformation_3::rational_rotate_z(angle, tolerance));
+        }
+
         void write_to_obj_file(std::string path)
         {
+            apply_pending_transformation();
+
+            ProfileScope profile("write_to_obj_file");
+
+            profile.add_input(*this);
+
             CGAL::Polyhedron_3<Kernel> p;
             convert_to_polyhedron(p);
 
@@ -101,8 +872,279 @@ namespace cpp_cad
 
             CGAL::print_wavefront(output_f, p);
         }
+
+        // Writes an approximation of the solid, without edges shorter than
+        // `decimation_tolerance`, and returns the facet counts before and
+        // after decimating.  See `decimate()`.
+        SimplificationReport write_to_obj_file(
+            std::string path, const Kernel::FT &decimation_tolerance)
+        {
+            apply_pending_transformation();
+
+            ProfileScope profile("write_to_obj_file");
+
+            profile.add_input(*this);
+
+            CGAL::Polyhedron_3<Kernel> p;
+            convert_to_polyhedron(p);
+
+            SimplificationReport res = decimate(p, decimation_tolerance);
+
+            std::ofstream output_f(path);
+
+            CGAL::print_wavefront(output_f, p);
+
+            return res;
+        }
+
+        private:
+
+        typedef Cylinder_3_TessalationBuilder<Surface_mesh, SurfaceMeshSink>
+            CylinderBuilder;
+
+        Nef_polyhedron_3(CGAL::Polyhedron_3<Kernel> &p, ProfileScope &&profile)
+            : CGAL::Nef_polyhedron_3<Kernel>(p)
+        {
+            profile.add_input(p);
+            profile.output(*this);
+        }
+
+        Nef_polyhedron_3(const Surface_mesh &mesh, ProfileScope &&profile)
+            : CGAL::Nef_polyhedron_3<Kernel>(mesh)
+        {
+            profile.add_input(mesh);
+            profile.output(*this);
+        }
+
+        // `args` follow the builders' halfedge data structure argument.
+        template <class... Args>
+        static Nef_polyhedron_3 build_sphere(
+            SphereTessalation tessalation,
+            const cpp_cad::Aff_transformation_3 *placement,
+            const Args &... args)
+        {
+            if (tessalation == SphereTessalation::GEODESIC)
+            {
+                return build<Icosphere_3_TessalationBuilder<
+                    Surface_mesh, SurfaceMeshSink>>(placement, args...);
+            }
+
+            return build<Sphere_3_TessalationBuilder<
+                Surface_mesh, SurfaceMeshSink>>(placement, args...);
+        }
+
+        // Returns a copy of the cached unit sphere, scaled to the radius.
+        static Nef_polyhedron_3 cached_sphere(
+            Coordinate circumsphere_r, int linear_subdivision_c,
+            SphereTessalation tessalation)
+        {
+            std::ostringstream key;
+
+            key << "sphere " << static_cast<int>(tessalation) << ' ' <<
+                linear_subdivision_c;
+
+            Nef_polyhedron_3 res(*TessalationCache::shared().get(key.str(),
+                [linear_subdivision_c, tessalation]() -> CGAL_Nef_polyhedron_3
+                {
+                    return unit_solid(build_sphere(tessalation, nullptr,
+                        Coordinate(1), linear_subdivision_c));
+                }));
+
+            return res.transform(
+                cpp_cad::Aff_transformation_3::scale(circumsphere_r));
+        }
+
+        // Returns a copy of the cached cylinder with the same subdivisions,
+        // and ratio of radii, with a larger radius of 1, and a height of 1,
+        // scaled to the radii, and height.
+        static Nef_polyhedron_3 cached_cylinder(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            int linear_subdivision_c)
+        {
+            const Coordinate r = base_r > top_r ? base_r : top_r;
+            const Coordinate unit_base_r = base_r / r;
+            const Coordinate unit_top_r = top_r / r;
+            std::ostringstream key;
+
+            // Ratios of radii, which round to the same double, need their
+            // own solids:
+            key << std::hexfloat << "cylinder " << linear_subdivision_c <<
+                ' ' << CGAL::exact(unit_base_r) <<
+                ' ' << CGAL::exact(unit_top_r);
+
+            Nef_polyhedron_3 res(*TessalationCache::shared().get(key.str(),
+                [unit_base_r, unit_top_r, linear_subdivision_c]()
+                    -> CGAL_Nef_polyhedron_3
+                {
+                    return unit_solid(build<CylinderBuilder>(nullptr,
+                        unit_base_r, unit_top_r, Coordinate(1),
+                        linear_subdivision_c));
+                }));
+
+            return res.transform(
+                cpp_cad::Aff_transformation_3::scale(r, r, height));
+        }
+
+        // Prepares a unit primitive for the tessalation cache.  Computing
+        // the exact values up front keeps the copies from computing them in
+        // the shared SNC from several threads.
+        static CGAL_Nef_polyhedron_3 unit_solid(Nef_polyhedron_3 res)
+        {
+            res.compact();
+
+            return res;
+        }
+
+        CGAL::Bbox_3 computed_bbox() const
+        {
+            const double inf = std::numeric_limits<double>::infinity();
+
+            if (is_empty())
+            {
+                return CGAL::Bbox_3(inf, inf, inf, -inf, -inf, -inf);
+            }
+
+            if (volumes_begin()->mark())
+            {
+                // The outer volume belongs to the solid:
+                return CGAL::Bbox_3(-inf, -inf, -inf, inf, inf, inf);
+            }
+
+            CGAL::Bbox_3 res(inf, inf, inf, -inf, -inf, -inf);
+
+            for (Vertex_const_iterator vit = vertices_begin();
+                vit != vertices_end();
+                ++vit)
+            {
+                res = res + vit->point().bbox();
+            }
+
+            return transformation_pending ? transformed_bbox(res) : res;
+        }
+
+        // Returns a box that contains the image of a box of the SNC under
+        // the pending transforms, and the rounding that follows them.
+        CGAL::Bbox_3 transformed_bbox(const CGAL::Bbox_3 &box) const
+        {
+            typedef CGAL::Interval_nt<> Interval;
+
+            const Kernel::FT &grid =
+                snap_grid != 0 ? snap_grid : default_snap_grid();
+            // Rounding moves vertices by up to half the grid spacing:
+            const Interval rounding = grid != 0 ?
+                Interval(CGAL::to_interval(grid / 2)) * Interval(-1, 1) :
+                Interval(0);
+            double min[3];
+            double max[3];
+
+            for (int i = 0; i < 3; ++i)
+            {
+                Interval coordinate(
+                    CGAL::to_interval(pending_transformation.m(i, 3)));
+
+                for (int j = 0; j < 3; ++j)
+                {
+                    coordinate += Interval(
+                        CGAL::to_interval(pending_transformation.m(i, j))) *
+                        Interval(box.min(j), box.max(j));
+                }
+                coordinate += rounding;
+                min[i] = coordinate.inf();
+                max[i] = coordinate.sup();
+            }
+
+            return CGAL::Bbox_3(min[0], min[1], min[2], max[0], max[1], max[2]);
+        }
+
+        inline void invalidate_bbox()
+        {
+            bbox_cache = std::make_shared<BboxCache>();
+        }
+
+        // Sets the box of a solid, whose box hasn't been computed.
+        void set_bbox(const CGAL::Bbox_3 &box)
+        {
+            BboxCache &cache = *bbox_cache;
+
+            std::call_once(cache.computed, [&cache, &box]()
+                {
+                    cache.bbox = box;
+                });
+        }
+
+        void snap_to_effective_grid()
+        {
+            const Kernel::FT &grid =
+                snap_grid != 0 ? snap_grid : default_snap_grid();
+
+            if (grid != 0)
+            {
+                snap_to_grid(grid);
+            }
+        }
+
+        // Rounds, and compacts the result of a boolean operation on this
+        // solid, and `rhs`, as configured.
+        Nef_polyhedron_3 finished_result(
+            Nef_polyhedron_3 res, const Nef_polyhedron_3 &rhs) const
+        {
+            static std::atomic<unsigned long> result_count(0);
+
+            res.snap_grid = snap_grid != 0 ? snap_grid : rhs.snap_grid;
+            if (simplify_results())
+            {
+                res.merge_coplanar_facets();
+            }
+            res.snap_to_effective_grid();
+
+            unsigned long interval = compact_interval();
+
+            if (interval != 0 && ++result_count % interval == 0)
+            {
+                res.compact();
+            }
+
+            return res;
+        }
+
+        // Returns the union of two solids, whose bounding boxes don't overlap.
+        Nef_polyhedron_3 disjoint_union(const Nef_polyhedron_3 &rhs) const
+        {
+            if (is_empty())
+            {
+                return rhs;
+            }
+
+            if (rhs.is_empty())
+            {
+                return *this;
+            }
+
+            // Overlaying the two structures is unnecessary, since they don't
+            // intersect.  Concatenate their boundaries, instead, when the
+            // boundaries are 2-manifolds:
+            if (!is_simple() || !rhs.is_simple())
+            {
+                return Nef_polyhedron_3(applied().CGAL_Nef_polyhedron_3::join(
+                    rhs.applied()));
+            }
+
+            Polyhedron_3 p;
+            CGAL::Polyhedron_3<Kernel> rhs_p;
+
+            convert_to_polyhedron(static_cast<CGAL::Polyhedron_3<Kernel>&>(p));
+            rhs.convert_to_polyhedron(rhs_p);
+            p.add_polyhedron(rhs_p);
+
+            Nef_polyhedron_3 res(p);
+
+            res.set_bbox(bbox() + rhs.bbox());
+
+            return res;
+        }
     };
 
 }
+}
 
 #endif // _CPP_CAD_NEF_POLYHEDRON_3_H
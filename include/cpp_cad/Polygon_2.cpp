@@ -5,30 +5,77 @@
 #include <CGAL/Projection_traits_xy_3.h>
 
 #include "Nef_polyhedron_3.h"
+#include "Polyhedron_3/LinearExtrusionBuilder.h"
+#include "Polyhedron_3/PolygonExtrusionBuilder.h"
+#include "Polyhedron_3/RotateExtrusionTrack.h"
+#include "Polyhedron_3/SurfaceMeshSink.h"
 #include "reference_frame.h"
 
 #include "Polygon_2.h"
 
 
 namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
 {
     Nef_polyhedron_3 Polygon_2::linear_extrude(Kernel::FT height)
     {
-        Polyhedron_3 p;
+        return Nef_polyhedron_3::build<LinearExtrusionBuilder<
+            Nef_polyhedron_3::Surface_mesh, SurfaceMeshSink>>(
+                nullptr, *this, height);
+    }
 
-        p.add_linear_extrusion(*this, height);
+    Nef_polyhedron_3 Polygon_2::rotate_extrude(double angle, int subdivision_c)
+    {
+        return rotate_extrude(angle, subdivision_c, nullptr);
+    }
 
-        return Nef_polyhedron_3(p);
+    Nef_polyhedron_3 Polygon_2::linear_extrude(
+        Kernel::FT height, const Aff_transformation_3 &placement)
+    {
+        return Nef_polyhedron_3::build<LinearExtrusionBuilder<
+            Nef_polyhedron_3::Surface_mesh, SurfaceMeshSink>>(
+                &placement, *this, height);
     }
 
-    Nef_polyhedron_3 Polygon_2::rotate_extrude(double angle, int subdivision_c)
+    Nef_polyhedron_3 Polygon_2::rotate_extrude(
+        double angle, int subdivision_c, const Aff_transformation_3 &placement)
+    {
+        return rotate_extrude(angle, subdivision_c, &placement);
+    }
+
+    Nef_polyhedron_3 Polygon_2::rotate_extrude(
+        double angle, const TessalationTolerance &tolerance)
+    {
+        return rotate_extrude(angle,
+            Polyhedron_3::rotate_extrusion_subdivision_count(
+                *this, angle, tolerance),
+            nullptr);
+    }
+
+    Nef_polyhedron_3 Polygon_2::rotate_extrude(
+        double angle, const TessalationTolerance &tolerance,
+        const Aff_transformation_3 &placement)
     {
-        Polyhedron_3 p;
+        return rotate_extrude(angle,
+            Polyhedron_3::rotate_extrusion_subdivision_count(
+                *this, angle, tolerance),
+            &placement);
+    }
 
-        p.add_rotate_extrusion(*this, angle, subdivision_c);
+    Nef_polyhedron_3 Polygon_2::rotate_extrude(
+        double angle, int subdivision_c, const Aff_transformation_3 *placement)
+    {
+        RotateExtrusionTrack track(*this, angle, subdivision_c);
+        RotateExtrusionTrack::Iterator track_begin = track.begin();
+        RotateExtrusionTrack::Iterator track_end = track.end();
 
-        return Nef_polyhedron_3(p);
+        return Nef_polyhedron_3::build<PolygonExtrusionBuilder<
+            Nef_polyhedron_3::Surface_mesh, RotateExtrusionTrack::Iterator,
+            SurfaceMeshSink>>(
+                placement, track_begin, track_end, track.is_closed());
     }
 }
+}
 
 #endif // _CPP_CAD_POLYGON_2_CPP
\ No newline at end of file
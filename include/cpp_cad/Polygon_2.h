@@ -7,9 +7,12 @@
 #include <CGAL/Projection_traits_xy_3.h>
 
 #include "reference_frame.h"
+#include "TessalationTolerance.h"
 
 
 namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
 {
     class Nef_polyhedron_3;
 
@@ -51,6 +54,13 @@ namespace cpp_cad
             return res;
         }
 
+        // Subdivides the circle as coarsely as `tolerance` allows.
+        static Polygon_2 make_circle(
+            double r, const TessalationTolerance &tolerance)
+        {
+            return make_circle(r, tolerance.circle_subdivision_count(r));
+        }
+
         using CGAL_Polygon_2::CGAL_Polygon_2;
 
         inline Polygon_2(const Traits &p_traits=Traits())
@@ -154,9 +164,34 @@ namespace cpp_cad
 
         Nef_polyhedron_3 linear_extrude(Kernel::FT height);
 
+        // Extrudes the polygon into a solid transformed by `placement`.
+        Nef_polyhedron_3 linear_extrude(
+            Kernel::FT height, const Aff_transformation_3 &placement);
+
         Nef_polyhedron_3 rotate_extrude(double angle = 2 * M_PI, int subdivision_c = 16);
+
+        Nef_polyhedron_3 rotate_extrude(
+            double angle, int subdivision_c,
+            const Aff_transformation_3 &placement);
+
+        // Subdivides the rotation as `tolerance` requires for the polygon's
+        // farthest vertex from the axis.
+        Nef_polyhedron_3 rotate_extrude(
+            double angle, const TessalationTolerance &tolerance);
+
+        Nef_polyhedron_3 rotate_extrude(
+            double angle, const TessalationTolerance &tolerance,
+            const Aff_transformation_3 &placement);
+
+        private:
+
+        // `placement` may be null.
+        Nef_polyhedron_3 rotate_extrude(
+            double angle, int subdivision_c,
+            const Aff_transformation_3 *placement);
     };
 
 }
+}
 
 #endif // _CPP_CAD_POLYGON_2_H
\ No newline at end of file
@@ -8,6 +8,8 @@
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // Constructs an iterator over the series of polygons given by a polygon and a
 // transform iterator.
@@ -74,6 +76,7 @@ public:
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_POLYGON_2_TRANSFORMS_ITERATOR_CPP
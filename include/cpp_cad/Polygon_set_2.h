@@ -11,6 +11,8 @@
 
 
 namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
 {
     typedef CGAL::Polygon_with_holes_2<Kernel>                Polygon_with_holes_2;
 
@@ -30,5 +32,6 @@ namespace cpp_cad
     };
 
 }
+}
 
 #endif // _CPP_CAD_POLYGON_SET_2_H
\ No newline at end of file
@@ -0,0 +1,102 @@
+#ifndef _CPP_CAD_CIRCLE_TABLE_H
+#define _CPP_CAD_CIRCLE_TABLE_H
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+namespace cpp_cad
+{
+
+// The cosines and sines of the angles `i * 2 pi / subdivision_c`, for `i`
+// from 0 to `subdivision_c - 1`.
+//     Each angle is computed from its index, instead of accumulating steps,
+// so the table doesn't drift, and is the same, whichever builder made it.
+// The table is symmetric about the x axis, and exact on the axes.  Tables
+// are kept in contiguous arrays, and shared through `get()`.
+class CircleTable
+{
+private:
+    std::vector<double> cosines;
+    std::vector<double> sines;
+
+public:
+    explicit CircleTable(int subdivision_c)
+    : cosines(subdivision_c),
+        sines(subdivision_c)
+    {
+        const double step = 2 * M_PI / subdivision_c;
+        // The angles past a half turn mirror the ones before it:
+        const int half_c = subdivision_c / 2;
+
+        for (int i = 0; i <= half_c; ++i)
+        {
+            cosines[i] = std::cos(i * step);
+        }
+        for (int i = 0; i <= half_c; ++i)
+        {
+            sines[i] = std::sin(i * step);
+        }
+
+        // Exact values on the axes:
+        sines[0] = 0;
+        cosines[0] = 1;
+        if (subdivision_c % 2 == 0)
+        {
+            sines[half_c] = 0;
+            cosines[half_c] = -1;
+        }
+        if (subdivision_c % 4 == 0)
+        {
+            sines[subdivision_c / 4] = 1;
+            cosines[subdivision_c / 4] = 0;
+        }
+
+        for (int i = half_c + 1; i < subdivision_c; ++i)
+        {
+            cosines[i] = cosines[subdivision_c - i];
+            sines[i] = -sines[subdivision_c - i];
+        }
+    }
+
+    // Returns the shared table for the subdivision count.  Tables are kept
+    // for the lifetime of the process, since there are few distinct
+    // subdivision counts.
+    static std::shared_ptr<const CircleTable> get(int subdivision_c)
+    {
+        static std::mutex tables_mutex;
+        static std::map<int, std::shared_ptr<const CircleTable>> tables;
+
+        std::lock_guard<std::mutex> lock(tables_mutex);
+        std::shared_ptr<const CircleTable> &res = tables[subdivision_c];
+
+        if (!res)
+        {
+            res = std::make_shared<const CircleTable>(subdivision_c);
+        }
+
+        return res;
+    }
+
+    inline int size() const
+    {
+        return cosines.size();
+    }
+
+    inline double cos(int i) const
+    {
+        return cosines[i];
+    }
+
+    inline double sin(int i) const
+    {
+        return sines[i];
+    }
+};
+
+}
+
+#endif // _CPP_CAD_CIRCLE_TABLE_H
@@ -11,14 +11,17 @@
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A class that uses a polyhedron incremental builer to build the faces of a
 // cube.
-template <class HDS>
-class Cube_3_Builder : public Polyhedron_3_BuilderBase<HDS>
+template <class HDS,
+    class Sink = CGAL::Polyhedron_incremental_builder_3<HDS>>
+class Cube_3_Builder : public Polyhedron_3_BuilderBase<HDS, Sink>
 {
 protected:
-    using Polyhedron_3_BuilderBase<HDS>::builder;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::builder;
 
 private:
     Kernel::FT x_length;
@@ -27,14 +30,14 @@ private:
 
 public:
     inline Cube_3_Builder(
-        CGAL::Polyhedron_3<Kernel> &polyhedron, HDS& hds,
+        HDS& hds,
         Kernel::FT x_length = 1,
         Kernel::FT y_length = 1,
         Kernel::FT z_length = 1)
     : x_length(x_length),
         y_length(y_length),
         z_length(z_length),
-        Polyhedron_3_BuilderBase<HDS>(polyhedron, hds)
+        Polyhedron_3_BuilderBase<HDS, Sink>(hds)
     {}
 
     void run()
@@ -51,8 +54,8 @@ public:
     }
 
 protected:
-    using Polyhedron_3_BuilderBase<HDS>::add_face;
-    using Polyhedron_3_BuilderBase<HDS>::add_vertex;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_face;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex;
 
 private:
     void add_tessalation()
@@ -106,6 +109,7 @@ private:
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_CUBE_3_BUILDER_H
@@ -6,6 +6,8 @@
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A polyhedron modifier that adds a cube to the polyhedron.
 template <class HDS>
@@ -15,28 +17,35 @@ private:
     Kernel::FT x_length;
     Kernel::FT y_length;
     Kernel::FT z_length;
-    CGAL::Polyhedron_3<Kernel> polyhedron;
+    // Null, if the built polyhedron stays in place:
+    const Aff_transformation_3 *placement;
 
 public:
     inline Cube_3_Modifier(
-        CGAL::Polyhedron_3<Kernel> &polyhedron,
-        Kernel::FT x_length = 1, Kernel::FT y_length = 1, Kernel::FT z_length = 1)
+        Kernel::FT x_length = 1, Kernel::FT y_length = 1, Kernel::FT z_length = 1,
+        const Aff_transformation_3 *placement = nullptr)
     : x_length(x_length),
         y_length(y_length),
         z_length(z_length),
-        polyhedron(polyhedron),
+        placement(placement),
         CGAL::Modifier_base<HDS>()
     {}
 
     void operator()(HDS& hds)
     {
         Cube_3_Builder<HDS> builder(
-            polyhedron, hds, x_length, y_length, z_length);
+            hds, x_length, y_length, z_length);
+
+        if (placement != nullptr)
+        {
+            builder.set_placement(*placement);
+        }
 
         builder.run();
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_CUBE_3_MODIFIER_H
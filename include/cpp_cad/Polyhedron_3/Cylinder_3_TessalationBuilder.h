@@ -4,24 +4,30 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
 #include <operation_log.h>
 
+#include "../TessalationTolerance.h"
+#include "CircleTable.h"
 #include "Polyhedron_3_BuilderBase.h"
 #include "Cylinder_3_operation_logging.h"
 
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A class that uses a polyhedron incremental builer to build the faces of a
 // cylinder tessalation.
-template <class HDS>
-class Cylinder_3_TessalationBuilder : public Polyhedron_3_BuilderBase<HDS>
+template <class HDS,
+    class Sink = CGAL::Polyhedron_incremental_builder_3<HDS>>
+class Cylinder_3_TessalationBuilder : public Polyhedron_3_BuilderBase<HDS, Sink>
 {
 protected:
-    using Polyhedron_3_BuilderBase<HDS>::builder;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::builder;
     OPERATION_LOG_CODE(
-        using Polyhedron_3_BuilderBase<HDS>::vertex_count;
+        using Polyhedron_3_BuilderBase<HDS, Sink>::vertex_count;
     )
 
 private:
@@ -29,10 +35,9 @@ private:
     Kernel::FT top_r;
     Kernel::FT height;
     int linear_subdivisions;
-    double top_longitude;
-    double top_longitude_step;
-    double base_longitude;
-    double base_longitude_step;
+    // Replaces `linear_subdivisions`, if set.  Each end's circle is then
+    // subdivided as the tolerance requires for its radius:
+    TessalationTolerance tolerance;
     int top_subdivision_c;
     int base_subdivision_c;
     int top_vertex_i;
@@ -47,27 +52,57 @@ private:
 
 public:
     inline Cylinder_3_TessalationBuilder(
-        CGAL::Polyhedron_3<Kernel> &polyhedron, HDS& hds,
+        HDS& hds,
         Kernel::FT base_r = 1,
         Kernel::FT top_r = 1,
         Kernel::FT height = 1,
-        int linear_subdivisions = 2)
+        int linear_subdivisions = 2,
+        const TessalationTolerance &tolerance = TessalationTolerance())
     : base_r(base_r),
         top_r(top_r),
         height(height),
         linear_subdivisions(linear_subdivisions),
-        Polyhedron_3_BuilderBase<HDS>(polyhedron, hds)
+        tolerance(tolerance),
+        Polyhedron_3_BuilderBase<HDS, Sink>(hds)
     {}
 
     void run()
     {
-        // Subdivide each end's circle into, at least, 3 parts:
-        base_subdivision_c = std::max(3, linear_subdivisions);
-        top_subdivision_c = std::max(
-            3, static_cast<int>( ceil(base_subdivision_c / CGAL::to_double(base_r * top_r)) ));
+        if (tolerance.is_set())
+        {
+            base_subdivision_c =
+                tolerance.circle_subdivision_count(CGAL::to_double(base_r));
+            top_subdivision_c =
+                tolerance.circle_subdivision_count(CGAL::to_double(top_r));
+        }
+        else
+        {
+            // Subdivide each end's circle into, at least, 3 parts, and the
+            // top circle in proportion to its radius:
+            base_subdivision_c = std::max(3, linear_subdivisions);
+            top_subdivision_c = base_r > 0 ?
+                std::max(3, static_cast<int>(ceil(base_subdivision_c *
+                    CGAL::to_double(top_r / base_r)))) :
+                base_subdivision_c;
+        }
+
+        // A 0-radius end is a single apex vertex, like the poles of a
+        // sphere:
+        assert(base_r > 0 || top_r > 0);
+        if (base_r == 0)
+        {
+            base_subdivision_c = 1;
+        }
+        if (top_r == 0)
+        {
+            top_subdivision_c = 1;
+        }
 
         int vertex_count = base_subdivision_c + top_subdivision_c;
-        int face_count = base_subdivision_c + top_subdivision_c;
+        // A fan around an apex has a triangle per vertex of the other end:
+        int face_count = base_subdivision_c == 1 ? top_subdivision_c :
+            top_subdivision_c == 1 ? base_subdivision_c :
+            base_subdivision_c + top_subdivision_c;
 
         // Each face has 3 halfedges.
         int halfedge_count = 3 * face_count;
@@ -78,44 +113,80 @@ public:
     }
 
 protected:
-    using Polyhedron_3_BuilderBase<HDS>::add_face;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_face;
 
 private:
     void add_tessalation()
     {
         OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
 
-        base_longitude_step = 2 * M_PI / base_subdivision_c;
-        top_longitude_step = 2 * M_PI / top_subdivision_c;
-
         // Add vertices:
         OPERATION_LOG_MESSAGE("Adding top circle vertices.");
         add_end_circle(
-            CGAL::to_double(top_r), top_longitude_step, top_subdivision_c,
-            CGAL::to_double(height));
+            CGAL::to_double(top_r), top_subdivision_c, CGAL::to_double(height));
         OPERATION_LOG_MESSAGE("Adding base circle vertices.");
-        add_end_circle(
-            CGAL::to_double(base_r), base_longitude_step, base_subdivision_c,
-            0);
+        add_end_circle(CGAL::to_double(base_r), base_subdivision_c, 0);
 
         base_vertex_i = top_subdivision_c;
         base_last_vertex_i = base_vertex_i + base_subdivision_c - 1;
         top_vertex_i = 0;
         top_last_vertex_i = top_vertex_i + top_subdivision_c - 1;
-        add_faces();
+        if (top_subdivision_c == 1)
+        {
+            add_top_apex_faces();
+        }
+        else if (base_subdivision_c == 1)
+        {
+            add_base_apex_faces();
+        }
+        else
+        {
+            add_faces();
+        }
 
         OPERATION_LOG_LEAVE_FUNCTION();
     }
 
-    void add_end_circle(double r, double longitude_step, int subdivision_c, double z)
+    // Connect each pair of consecutive base circle vertices to the top
+    // apex.
+    void add_top_apex_faces()
     {
         OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
 
-        double longitude = 0.0;
+        for (int c = 0; c < base_subdivision_c; ++c)
+        {
+            add_face(top_vertex_i, base_vertex_i + c,
+                base_vertex_i + (c + 1) % base_subdivision_c);
+        }
 
-        for (int c = 0; c < subdivision_c; ++c, longitude += longitude_step)
+        OPERATION_LOG_LEAVE_FUNCTION();
+    }
+
+    // Connect each pair of consecutive top circle vertices to the base
+    // apex.
+    void add_base_apex_faces()
+    {
+        OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
+
+        for (int c = 0; c < top_subdivision_c; ++c)
         {
-            add_vertex(r, longitude, z);
+            add_face(top_vertex_i + c, base_vertex_i,
+                top_vertex_i + (c + 1) % top_subdivision_c);
+        }
+
+        OPERATION_LOG_LEAVE_FUNCTION();
+    }
+
+    void add_end_circle(double r, int subdivision_c, double z)
+    {
+        OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
+
+        std::shared_ptr<const CircleTable> table =
+            CircleTable::get(subdivision_c);
+
+        for (int c = 0; c < subdivision_c; ++c)
+        {
+            add_vertex(r * table->cos(c), r * table->sin(c), z);
         }
 
         OPERATION_LOG_LEAVE_FUNCTION();
@@ -285,20 +356,16 @@ private:
         OPERATION_LOG_LEAVE_FUNCTION();
     }
 
-    inline void add_vertex(double r, double longitude, double z)
+    inline void add_vertex(double x, double y, double z)
     {
-        OPERATION_LOG_ENTER_FUNCTION(r, longitude / M_PI, z);
-
-        Kernel::Point_3 point(r * cos(longitude), r * sin(longitude), z);
+        OPERATION_LOG_ENTER_FUNCTION(x, y, z);
 
-        OPERATION_LOG_MESSAGE_STREAM(<<
-            "Vertex " << vertex_count << ": " << point);
+        Kernel::Point_3 point(x, y, z);
 
-        builder.add_vertex(point);
+        // The base class places, and counts the vertex:
+        Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex(point);
 
         OPERATION_LOG_CODE(
-            vertex_count++;
-
             cpp_cad_log::log_cylinder_tessalation_builder_vertices(
                 CGAL::to_double(base_r), CGAL::to_double(top_r),
                 CGAL::to_double(height), builder, vertex_count);
@@ -308,6 +375,7 @@ private:
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_CYLINDER_3_TESSALATION_BUILDER_H
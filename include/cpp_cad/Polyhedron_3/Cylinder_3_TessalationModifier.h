@@ -6,6 +6,8 @@
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A polyhedron modifier that adds a tessalation of a cylinder to the
 // polyhedron.
@@ -17,30 +19,53 @@ private:
     Kernel::FT top_r;
     Kernel::FT height;
     int linear_subdivisions;
-    CGAL::Polyhedron_3<Kernel> polyhedron;
+    // Replaces `linear_subdivisions`, if set:
+    TessalationTolerance tolerance;
+    // Null, if the built polyhedron stays in place:
+    const Aff_transformation_3 *placement;
 
 public:
     inline Cylinder_3_TessalationModifier(
-        CGAL::Polyhedron_3<Kernel> &polyhedron,
         Kernel::FT base_r = 1, Kernel::FT top_r = 1, Kernel::FT height = 1,
-        int linear_subdivisions = 2)
+        int linear_subdivisions = 2,
+        const Aff_transformation_3 *placement = nullptr)
     : base_r(base_r),
         top_r(top_r),
         height(height),
         linear_subdivisions(linear_subdivisions),
-        polyhedron(polyhedron),
+        placement(placement),
+        CGAL::Modifier_base<HDS>()
+    {}
+
+    inline Cylinder_3_TessalationModifier(
+        Kernel::FT base_r, Kernel::FT top_r, Kernel::FT height,
+        const TessalationTolerance &tolerance,
+        const Aff_transformation_3 *placement = nullptr)
+    : base_r(base_r),
+        top_r(top_r),
+        height(height),
+        linear_subdivisions(0),
+        tolerance(tolerance),
+        placement(placement),
         CGAL::Modifier_base<HDS>()
     {}
 
     void operator()(HDS& hds)
     {
         Cylinder_3_TessalationBuilder<HDS> builder(
-            polyhedron, hds, base_r, top_r, height, linear_subdivisions);
+            hds, base_r, top_r, height, linear_subdivisions,
+            tolerance);
+
+        if (placement != nullptr)
+        {
+            builder.set_placement(*placement);
+        }
 
         builder.run();
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_CYLINDER_3_TESSALATION_MODIFIER_H
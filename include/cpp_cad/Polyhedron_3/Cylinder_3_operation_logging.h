@@ -15,10 +15,10 @@ namespace cpp_cad_log
 
 #ifdef OPERATION_LOG
 
-template <class HDS>
+template <class Builder>
 void log_cylinder_tessalation_builder_vertices(
     double base_r, double top_r, double height,
-    CGAL::Polyhedron_incremental_builder_3<HDS> &builder, int vertex_count,
+    Builder &builder, int vertex_count,
     std::string extra_code = "")
 {
     std::stringstream extra_code_buf(extra_code);
@@ -0,0 +1,272 @@
+#ifndef _CPP_CAD_ICOSPHERE_3_TESSALATION_BUILDER_H
+#define _CPP_CAD_ICOSPHERE_3_TESSALATION_BUILDER_H
+
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+#include <vector>
+#include <operation_log.h>
+
+#include "../TessalationTolerance.h"
+#include "Polyhedron_3_BuilderBase.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// A class that uses a polyhedron incremental builer to build the faces of a
+// geodesic sphere tessalation.
+//     Each edge of an icosahedron inscribed in the sphere is divided in
+// `frequency` parts, each of its faces in `frequency`^2 triangles, and the
+// vertices are projected on the sphere.  Unlike a latitude / longitude
+// tessalation, the triangles have about the same size everywhere, so fewer
+// vertices reach the same chord error.
+template <class HDS,
+    class Sink = CGAL::Polyhedron_incremental_builder_3<HDS>>
+class Icosphere_3_TessalationBuilder :
+    public Polyhedron_3_BuilderBase<HDS, Sink>
+{
+protected:
+    using Polyhedron_3_BuilderBase<HDS, Sink>::builder;
+
+private:
+    // Identifies a vertex by the icosahedron vertices it lies between:
+    //     * (vertex, -1, 0) for an icosahedron vertex;
+    //     * (first vertex, second vertex, steps from the first vertex) for a
+    //       vertex on an icosahedron edge, whose first vertex is the lower
+    //       index;
+    //     * (-1, face, index in face) for a vertex inside an icosahedron face.
+    typedef std::tuple<int, int, int> VertexKey;
+
+    double circumsphere_r;
+    int frequency;
+    std::vector<double> icosahedron_vertices;
+    std::map<VertexKey, int> vertex_indices;
+    int next_vertex_i;
+
+public:
+    inline Icosphere_3_TessalationBuilder(
+        HDS& hds,
+        Kernel::FT circumsphere_r = 1, int linear_subdivisions = 2,
+        const TessalationTolerance &tolerance = TessalationTolerance())
+    : circumsphere_r(CGAL::to_double(circumsphere_r)),
+        frequency(tolerance.is_set() ?
+            subdivision_frequency(CGAL::to_double(circumsphere_r), tolerance) :
+            subdivision_frequency(linear_subdivisions)),
+        Polyhedron_3_BuilderBase<HDS, Sink>(hds)
+    {}
+
+    // Returns the number of parts each icosahedron edge is divided in.  A
+    // great circle has about 5.7 icosahedron edges, so the tessalation has
+    // about `linear_subdivisions` edges per great circle, as the latitude /
+    // longitude tessalation does.
+    inline static int subdivision_frequency(int linear_subdivisions)
+    {
+        return std::max(1, static_cast<int>(ceil(linear_subdivisions / 6.0)));
+    }
+
+    // Returns the smallest number of parts each icosahedron edge must be
+    // divided in to meet `tolerance`.
+    //     The longest edges span up to 1.2 times the icosahedron's edge
+    // angle over the frequency, and the triangles' circumcircles span about
+    // the edge angle over sqrt(3), plus 4%, going by measurements of
+    // frequencies 1 to 32.
+    inline static int subdivision_frequency(
+        double circumsphere_r, const TessalationTolerance &tolerance)
+    {
+        const double longest_edge_angle = 1.2 * acos(1 / sqrt(5.0));
+        double max_edge_angle = 2 * M_PI;
+
+        if (tolerance.max_angle > 0)
+        {
+            max_edge_angle = tolerance.max_angle;
+        }
+        if (tolerance.max_chord_deviation > 0)
+        {
+            // The deviation bounds the circumcircles' angular radii to half
+            // the step angle of a circle with the sphere's radius:
+            TessalationTolerance chord_tolerance =
+                TessalationTolerance::chord_deviation(
+                    tolerance.max_chord_deviation);
+
+            max_edge_angle = std::min(max_edge_angle,
+                sqrt(3.0) / 2 / 1.04 *
+                    chord_tolerance.max_step_angle(circumsphere_r));
+        }
+
+        return std::max(1, static_cast<int>(
+            ceil(longest_edge_angle / max_edge_angle)));
+    }
+
+    void run()
+    {
+        OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
+
+        int vertex_count = 10 * frequency * frequency + 2;
+        int face_count = 20 * frequency * frequency;
+        // Each face has 3 halfedges.
+        int halfedge_count = 3 * face_count;
+
+        init_icosahedron_vertices();
+        vertex_indices.clear();
+        next_vertex_i = 0;
+
+        builder.begin_surface(vertex_count, face_count, halfedge_count);
+        for (int face_i = 0; face_i < 20; ++face_i)
+        {
+            add_icosahedron_face(face_i);
+        }
+        builder.end_surface();
+
+        OPERATION_LOG_LEAVE_FUNCTION();
+    }
+
+protected:
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_face;
+
+private:
+    // The icosahedron's vertices are (+-1, +-phi, 0), and their cyclic
+    // permutations, where phi is the golden ratio:
+    void init_icosahedron_vertices()
+    {
+        const double phi = (1 + sqrt(5.0)) / 2;
+        const double vertices[12][3] = {
+            {-1,  phi,  0}, { 1,  phi,  0}, {-1, -phi,  0}, { 1, -phi,  0},
+            { 0, -1,  phi}, { 0,  1,  phi}, { 0, -1, -phi}, { 0,  1, -phi},
+            { phi,  0, -1}, { phi,  0,  1}, {-phi,  0, -1}, {-phi,  0,  1}
+        };
+
+        icosahedron_vertices.assign(&vertices[0][0], &vertices[0][0] + 36);
+    }
+
+    // Returns the icosahedron vertex indices of a face, counterclockwise,
+    // seen from outside.
+    inline static const int *icosahedron_face(int face_i)
+    {
+        static const int faces[20][3] = {
+            {0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
+            {1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+            {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
+            {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1}
+        };
+
+        return faces[face_i];
+    }
+
+    // Adds the triangles of an icosahedron face.  The face's point (i, j)
+    // is `i` steps from its first vertex towards its second, and `j` steps
+    // towards its third.
+    void add_icosahedron_face(int face_i)
+    {
+        OPERATION_LOG_ENTER_FUNCTION(face_i);
+
+        std::vector<int> row;
+        std::vector<int> next_row;
+
+        for (int j = 0; j <= frequency; ++j)
+        {
+            row.push_back(vertex_index(face_i, 0, j));
+        }
+
+        for (int i = 1; i <= frequency; ++i)
+        {
+            next_row.clear();
+            for (int j = 0; i + j <= frequency; ++j)
+            {
+                next_row.push_back(vertex_index(face_i, i, j));
+            }
+
+            for (int j = 0; j < static_cast<int>(next_row.size()); ++j)
+            {
+                add_face(row[j], next_row[j], row[j + 1]);
+                if (j + 1 < static_cast<int>(next_row.size()))
+                {
+                    add_face(row[j + 1], next_row[j], next_row[j + 1]);
+                }
+            }
+
+            row.swap(next_row);
+        }
+
+        OPERATION_LOG_LEAVE_FUNCTION();
+    }
+
+    // Returns the index of the face's point (i, j), and adds the vertex, if
+    // it hasn't been added by a neighboring face.
+    int vertex_index(int face_i, int i, int j)
+    {
+        const int *face = icosahedron_face(face_i);
+        // Steps towards each face vertex:
+        const int steps[3] = {frequency - i - j, i, j};
+        VertexKey key;
+
+        if (steps[0] == frequency || steps[1] == frequency ||
+            steps[2] == frequency)
+        {
+            int k = steps[0] == frequency ? 0 : (steps[1] == frequency ? 1 : 2);
+
+            key = VertexKey(face[k], -1, 0);
+        }
+        else if (steps[0] == 0 || steps[1] == 0 || steps[2] == 0)
+        {
+            // The edge's vertices are the ones with non-zero steps:
+            int k = steps[0] == 0 ? 1 : 0;
+            int l = steps[2] == 0 ? 1 : 2;
+
+            if (face[k] > face[l])
+            {
+                std::swap(k, l);
+            }
+            key = VertexKey(face[k], face[l], steps[l]);
+        }
+        else
+        {
+            key = VertexKey(-1, face_i, i * (frequency + 1) + j);
+        }
+
+        std::map<VertexKey, int>::const_iterator it = vertex_indices.find(key);
+
+        if (it != vertex_indices.end())
+        {
+            return it->second;
+        }
+
+        add_vertex(face, steps);
+        vertex_indices[key] = next_vertex_i;
+
+        return next_vertex_i++;
+    }
+
+    // Adds the point with the barycentric `steps` on an icosahedron face,
+    // projected on the sphere.
+    inline void add_vertex(const int *face, const int *steps)
+    {
+        double x = 0;
+        double y = 0;
+        double z = 0;
+
+        for (int k = 0; k < 3; ++k)
+        {
+            const double *vertex = &icosahedron_vertices[3 * face[k]];
+
+            x += steps[k] * vertex[0];
+            y += steps[k] * vertex[1];
+            z += steps[k] * vertex[2];
+        }
+
+        const double scale = circumsphere_r / sqrt(x * x + y * y + z * z);
+
+        // The base class places, and counts the vertex:
+        Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex(
+            Kernel::Point_3(x * scale, y * scale, z * scale));
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_ICOSPHERE_3_TESSALATION_BUILDER_H
@@ -0,0 +1,61 @@
+#ifndef _CPP_CAD_ICOSPHERE_3_TESSALATION_MODIFIER_H
+#define _CPP_CAD_ICOSPHERE_3_TESSALATION_MODIFIER_H
+
+#include "../reference_frame.h"
+#include "Icosphere_3_TessalationBuilder.h"
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// A polyhedron modifier that adds a geodesic tessalation of a sphere to the
+// polyhedron.
+template <class HDS>
+class Icosphere_3_TessalationModifier : public CGAL::Modifier_base<HDS>
+{
+private:
+    Kernel::FT circumsphere_r;
+    int linear_subdivisions;
+    // Replaces `linear_subdivisions`, if set:
+    TessalationTolerance tolerance;
+    // Null, if the built polyhedron stays in place:
+    const Aff_transformation_3 *placement;
+
+public:
+    inline Icosphere_3_TessalationModifier(Kernel::FT circumsphere_r = 1, int linear_subdivisions = 2,
+        const Aff_transformation_3 *placement = nullptr)
+    : circumsphere_r(circumsphere_r),
+        linear_subdivisions(linear_subdivisions),
+        placement(placement),
+        CGAL::Modifier_base<HDS>()
+    {}
+
+    inline Icosphere_3_TessalationModifier(Kernel::FT circumsphere_r,
+        const TessalationTolerance &tolerance,
+        const Aff_transformation_3 *placement = nullptr)
+    : circumsphere_r(circumsphere_r),
+        linear_subdivisions(0),
+        tolerance(tolerance),
+        placement(placement),
+        CGAL::Modifier_base<HDS>()
+    {}
+
+    void operator()(HDS& hds)
+    {
+        Icosphere_3_TessalationBuilder<HDS> builder(hds, circumsphere_r, linear_subdivisions,
+            tolerance);
+
+        if (placement != nullptr)
+        {
+            builder.set_placement(*placement);
+        }
+
+        builder.run();
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_ICOSPHERE_3_TESSALATION_MODIFIER_H
@@ -0,0 +1,106 @@
+#ifndef _CPP_CAD_INDEXED_MESH_BUILDER_H
+#define _CPP_CAD_INDEXED_MESH_BUILDER_H
+
+
+#include <cstddef>
+#include <operation_log.h>
+
+#include "../IndexedMesh.h"
+#include "../reference_frame.h"
+#include "Polyhedron_3_BuilderBase.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// A class that uses a polyhedron incremental builder to add the vertices,
+// and faces of an `IndexedMesh`.
+//     The sink's storage is reserved for the whole mesh, and the arrays are
+// read once, in order.
+template <class HDS,
+    class Sink = CGAL::Polyhedron_incremental_builder_3<HDS>>
+class IndexedMeshBuilder : public Polyhedron_3_BuilderBase<HDS, Sink>
+{
+protected:
+    using Polyhedron_3_BuilderBase<HDS, Sink>::builder;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::begin_facet;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex_to_facet;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::end_facet;
+    OPERATION_LOG_CODE(
+        using Polyhedron_3_BuilderBase<HDS, Sink>::face_count;
+    )
+
+private:
+    const IndexedMesh &mesh;
+
+public:
+    inline IndexedMeshBuilder(HDS& hds, const IndexedMesh &mesh)
+    : mesh(mesh),
+        Polyhedron_3_BuilderBase<HDS, Sink>(hds)
+    {}
+
+    // Throws `std::invalid_argument`, if the mesh isn't valid, before
+    // adding anything.
+    void run()
+    {
+        mesh.validate();
+
+        // Each vertex of a face starts a halfedge.
+        builder.begin_surface(
+            mesh.vertex_count, mesh.face_count, mesh.index_count());
+        add_vertices();
+        add_faces();
+        builder.end_surface();
+    }
+
+protected:
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex;
+
+private:
+    void add_vertices()
+    {
+        OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
+
+        const double *coordinates = mesh.coordinates;
+
+        for (std::size_t vertex_i = 0; vertex_i < mesh.vertex_count;
+            ++vertex_i, coordinates += 3)
+        {
+            add_vertex(coordinates[0], coordinates[1], coordinates[2]);
+        }
+
+        OPERATION_LOG_LEAVE_FUNCTION();
+    }
+
+    void add_faces()
+    {
+        OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
+
+        for (std::size_t face_i = 0; face_i < mesh.face_count; ++face_i)
+        {
+            const std::size_t *index = mesh.indices + mesh.face_offsets[face_i];
+            const std::size_t *face_end =
+                mesh.indices + mesh.face_offsets[face_i + 1];
+
+            begin_facet();
+            for (; index != face_end; ++index)
+            {
+                add_vertex_to_facet(*index);
+            }
+            end_facet();
+
+            OPERATION_LOG_CODE(
+                ++face_count;
+            )
+        }
+
+        OPERATION_LOG_LEAVE_FUNCTION();
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_INDEXED_MESH_BUILDER_H
@@ -0,0 +1,47 @@
+#ifndef _CPP_CAD_INDEXED_MESH_MODIFIER_H
+#define _CPP_CAD_INDEXED_MESH_MODIFIER_H
+
+#include "../reference_frame.h"
+#include "IndexedMeshBuilder.h"
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// A polyhedron modifier that adds the vertices, and faces of an
+// `IndexedMesh` to the polyhedron.
+template <class HDS>
+class IndexedMeshModifier : public CGAL::Modifier_base<HDS>
+{
+private:
+    const IndexedMesh &mesh;
+    // Null, if the built polyhedron stays in place:
+    const Aff_transformation_3 *placement;
+
+public:
+    inline IndexedMeshModifier(
+        const IndexedMesh &mesh,
+        const Aff_transformation_3 *placement = nullptr)
+    : mesh(mesh),
+        placement(placement),
+        CGAL::Modifier_base<HDS>()
+    {}
+
+    void operator()(HDS& hds)
+    {
+        IndexedMeshBuilder<HDS> builder(hds, mesh);
+
+        if (placement != nullptr)
+        {
+            builder.set_placement(*placement);
+        }
+
+        builder.run();
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_INDEXED_MESH_MODIFIER_H
@@ -13,15 +13,21 @@
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A class that extrudes a polygon in the xy plane into a 3D polyhedron.
-template <class HDS>
-class LinearExtrusionBuilder : public Polyhedron_3_BuilderBase<HDS>
+template <class HDS,
+    class Sink = CGAL::Polyhedron_incremental_builder_3<HDS>>
+class LinearExtrusionBuilder : public Polyhedron_3_BuilderBase<HDS, Sink>
 {
 protected:
-    using Polyhedron_3_BuilderBase<HDS>::builder;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::builder;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::begin_facet;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex_to_facet;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::end_facet;
     OPERATION_LOG_CODE(
-        using Polyhedron_3_BuilderBase<HDS>::face_count;
+        using Polyhedron_3_BuilderBase<HDS, Sink>::face_count;
     )
 
 private:
@@ -30,12 +36,12 @@ private:
 
 public:
     inline LinearExtrusionBuilder(
-        CGAL::Polyhedron_3<Kernel> &polyhedron, HDS& hds,
+        HDS& hds,
         const Polygon_2 &polygon,
         Kernel::FT height = 1)
     : polygon(polygon),
         height(height),
-        Polyhedron_3_BuilderBase<HDS>(polyhedron, hds)
+        Polyhedron_3_BuilderBase<HDS, Sink>(hds)
     {}
 
     void run()
@@ -55,8 +61,8 @@ public:
     }
 
 protected:
-    using Polyhedron_3_BuilderBase<HDS>::add_face;
-    using Polyhedron_3_BuilderBase<HDS>::add_vertex;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_face;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex;
 
 private:
     void add_tessalation()
@@ -116,14 +122,14 @@ private:
 
         int vertex_index = 0;
 
-        builder.begin_facet();
+        begin_facet();
         for (vit = polygon.vertices_begin();
             vit != polygon.vertices_end();
             ++vit, ++vertex_index)
         {
-            builder.add_vertex_to_facet(vertex_index);
+            add_vertex_to_facet(vertex_index);
         }
-        builder.end_facet();
+        end_facet();
 
         OPERATION_LOG_CODE(
             ++face_count;
@@ -183,14 +189,14 @@ private:
 
         int vertex_index = 2 * polygon.size() - 1;
 
-        builder.begin_facet();
+        begin_facet();
         for (vit = polygon.vertices_begin();
             vit != polygon.vertices_end();
             ++vit, --vertex_index)
         {
-            builder.add_vertex_to_facet(vertex_index);
+            add_vertex_to_facet(vertex_index);
         }
-        builder.end_facet();
+        end_facet();
 
         OPERATION_LOG_CODE(
             ++face_count;
@@ -200,6 +206,7 @@ private:
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_LINEAR_EXTRUSION_BUILDER_H
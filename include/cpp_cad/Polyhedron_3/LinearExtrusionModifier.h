@@ -6,6 +6,8 @@
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A polyhedron modifier that adds a polygon extrusion along the z axis to the
 // polyhedron.
@@ -15,27 +17,34 @@ class LinearExtrusionModifier : public CGAL::Modifier_base<HDS>
 private:
     Kernel::FT height;
     const Polygon_2 &polygon;
-    CGAL::Polyhedron_3<Kernel> polyhedron;
+    // Null, if the built polyhedron stays in place:
+    const Aff_transformation_3 *placement;
 
 public:
     inline LinearExtrusionModifier(
-        CGAL::Polyhedron_3<Kernel> &polyhedron,
-        const Polygon_2 &polygon, Kernel::FT height = 1)
+        const Polygon_2 &polygon, Kernel::FT height = 1,
+        const Aff_transformation_3 *placement = nullptr)
     : polygon(polygon),
         height(height),
-        polyhedron(polyhedron),
+        placement(placement),
         CGAL::Modifier_base<HDS>()
     {}
 
     void operator()(HDS& hds)
     {
         LinearExtrusionBuilder<HDS> builder(
-            polyhedron, hds, polygon, height);
+            hds, polygon, height);
+
+        if (placement != nullptr)
+        {
+            builder.set_placement(*placement);
+        }
 
         builder.run();
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_LINEAR_EXTRUSION_MODIFIER_H
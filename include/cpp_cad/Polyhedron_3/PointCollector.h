@@ -0,0 +1,57 @@
+#ifndef _CPP_CAD_POINT_COLLECTOR_H
+#define _CPP_CAD_POINT_COLLECTOR_H
+
+#include <vector>
+
+#include "../reference_frame.h"
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// A builder sink that collects the added vertices, and ignores the faces.
+//     Builders, whose `HDS` is a vector of points, and whose `Sink` is a
+// `PointCollector`, stream their vertices into the vector, without building
+// a halfedge data structure.
+class PointCollector
+{
+private:
+    std::vector<Point_3> &points;
+
+public:
+    typedef std::size_t size_type;
+
+    inline PointCollector(std::vector<Point_3> &points, bool verbose = false)
+    : points(points)
+    {}
+
+    inline void begin_surface(
+        size_type vertex_count, size_type face_count,
+        size_type halfedge_count = 0)
+    {
+        points.reserve(points.size() + vertex_count);
+    }
+
+    inline void add_vertex(const Point_3 &point)
+    {
+        points.push_back(point);
+    }
+
+    inline void begin_facet()
+    {}
+
+    inline void add_vertex_to_facet(size_type vertex_index)
+    {}
+
+    inline void end_facet()
+    {}
+
+    inline void end_surface()
+    {}
+};
+
+}
+}
+
+#endif // _CPP_CAD_POINT_COLLECTOR_H
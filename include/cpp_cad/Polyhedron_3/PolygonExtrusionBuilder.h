@@ -17,17 +17,23 @@
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A class that connects a sequence of bijective polygons (track) into a
 // 3D polyhedron.
-template <class HDS, class PolygonInputIterator>
-class PolygonExtrusionBuilder : public Polyhedron_3_BuilderBase<HDS>
+template <class HDS, class PolygonInputIterator,
+    class Sink = CGAL::Polyhedron_incremental_builder_3<HDS>>
+class PolygonExtrusionBuilder : public Polyhedron_3_BuilderBase<HDS, Sink>
 {
 protected:
-    using Polyhedron_3_BuilderBase<HDS>::builder;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::builder;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::begin_facet;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex_to_facet;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::end_facet;
     OPERATION_LOG_CODE(
-        using Polyhedron_3_BuilderBase<HDS>::vertex_count;
-        using Polyhedron_3_BuilderBase<HDS>::face_count;
+        using Polyhedron_3_BuilderBase<HDS, Sink>::vertex_count;
+        using Polyhedron_3_BuilderBase<HDS, Sink>::face_count;
     )
 
 private:
@@ -40,14 +46,14 @@ private:
 
 public:
     inline PolygonExtrusionBuilder(
-        CGAL::Polyhedron_3<Kernel> &polyhedron, HDS& hds,
+        HDS& hds,
         PolygonInputIterator &track_start,
         const PolygonInputIterator &track_end,
         bool closed = false)
     : track_start(track_start),
         track_end(track_end),
         closed(closed),
-        Polyhedron_3_BuilderBase<HDS>(polyhedron, hds)
+        Polyhedron_3_BuilderBase<HDS, Sink>(hds)
     {}
 
     void run()
@@ -149,7 +155,7 @@ private:
 
         int last_vertex_index = slice_vertex_index;
 
-        builder.begin_facet();
+        begin_facet();
 
         OPERATION_LOG_MESSAGE_STREAM_OPEN(vertex_msg);
         OPERATION_LOG_MESSAGE_STREAM_WRITE(vertex_msg, << "Face " << face_count << ":");
@@ -159,12 +165,12 @@ private:
             --vertex_index)
         {
             OPERATION_LOG_MESSAGE_STREAM_WRITE(vertex_msg, << " " << vertex_index);
-            builder.add_vertex_to_facet(vertex_index);
+            add_vertex_to_facet(vertex_index);
         }
 
         OPERATION_LOG_MESSAGE_STREAM_CLOSE(vertex_msg);
 
-        builder.end_facet();
+        end_facet();
 
         OPERATION_LOG_CODE(
             ++face_count;
@@ -176,7 +182,7 @@ private:
     {
         OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
 
-        builder.begin_facet();
+        begin_facet();
 
         int last_vertex_index = slice_vertex_index - 1;
 
@@ -188,12 +194,12 @@ private:
             ++vertex_index)
         {
             OPERATION_LOG_MESSAGE_STREAM_WRITE(vertex_msg, << " " << vertex_index);
-            builder.add_vertex_to_facet(vertex_index);
+            add_vertex_to_facet(vertex_index);
         }
 
         OPERATION_LOG_MESSAGE_STREAM_CLOSE(vertex_msg);
 
-        builder.end_facet();
+        end_facet();
 
         OPERATION_LOG_CODE(
             ++face_count;
@@ -255,7 +261,7 @@ private:
     {
         OPERATION_LOG_ENTER_FUNCTION(point);
 
-        Polyhedron_3_BuilderBase<HDS>::add_vertex(point);
+        Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex(point);
 
         OPERATION_LOG_CODE(
             cpp_cad_log::log_polygon_extrusion_builder_vertices(polygon_vertex_count, builder, vertex_count);
@@ -265,6 +271,7 @@ private:
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_POLYGON_EXTRUSION_BUILDER_H
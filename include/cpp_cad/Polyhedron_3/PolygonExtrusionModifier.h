@@ -6,6 +6,8 @@
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A polyhedron modifier that adds a polygon extrusion to the polyhedron.
 template <class HDS, class PolygonInputIterator>
@@ -15,29 +17,36 @@ private:
     bool closed;
     PolygonInputIterator &track_start;
     const PolygonInputIterator &track_end;
-    CGAL::Polyhedron_3<Kernel> polyhedron;
+    // Null, if the built polyhedron stays in place:
+    const Aff_transformation_3 *placement;
 
 public:
     inline PolygonExtrusionModifier(
-        CGAL::Polyhedron_3<Kernel> &polyhedron,
         PolygonInputIterator &track_start,
-        const PolygonInputIterator &track_end, bool closed = false)
+        const PolygonInputIterator &track_end, bool closed = false,
+        const Aff_transformation_3 *placement = nullptr)
     : track_start(track_start),
         track_end(track_end),
         closed(closed),
-        polyhedron(polyhedron),
+        placement(placement),
         CGAL::Modifier_base<HDS>()
     {}
 
     void operator()(HDS& hds)
     {
         PolygonExtrusionBuilder<HDS, PolygonInputIterator> builder(
-            polyhedron, hds, track_start, track_end, closed);
+            hds, track_start, track_end, closed);
+
+        if (placement != nullptr)
+        {
+            builder.set_placement(*placement);
+        }
 
         builder.run();
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_POLYGON_EXTRUSION_MODIFIER_H
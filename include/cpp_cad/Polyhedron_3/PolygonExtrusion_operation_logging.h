@@ -17,10 +17,10 @@ namespace cpp_cad_log
 
 #ifdef OPERATION_LOG
 
-template <class HDS>
+template <class Builder>
 void log_polygon_extrusion_builder_vertices(
     int polygon_vertex_count,
-    CGAL::Polyhedron_incremental_builder_3<HDS> &builder, int vertex_count,
+    Builder &builder, int vertex_count,
     std::string extra_code = "")
 {
     std::stringstream extra_code_buf(extra_code);
@@ -0,0 +1,103 @@
+#ifndef _CPP_CAD_POLYHEDRON_COPY_BUILDER_H
+#define _CPP_CAD_POLYHEDRON_COPY_BUILDER_H
+
+
+#include <operation_log.h>
+
+#include <CGAL/Unique_hash_map.h>
+
+#include "../reference_frame.h"
+#include "Polyhedron_3_BuilderBase.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// A class that uses a polyhedron incremental builder to copy the vertices and
+// faces of another polyhedron.
+template <class HDS,
+    class Sink = CGAL::Polyhedron_incremental_builder_3<HDS>>
+class PolyhedronCopyBuilder : public Polyhedron_3_BuilderBase<HDS, Sink>
+{
+protected:
+    using Polyhedron_3_BuilderBase<HDS, Sink>::builder;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::begin_facet;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex_to_facet;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::end_facet;
+    OPERATION_LOG_CODE(
+        using Polyhedron_3_BuilderBase<HDS, Sink>::face_count;
+    )
+
+private:
+    typedef CGAL::Polyhedron_3<Kernel> Source;
+
+    const Source &source;
+
+public:
+    inline PolyhedronCopyBuilder(
+        HDS& hds,
+        const Source &source)
+    : source(source),
+        Polyhedron_3_BuilderBase<HDS, Sink>(hds)
+    {}
+
+    void run()
+    {
+        builder.begin_surface(
+            source.size_of_vertices(), source.size_of_facets(),
+            source.size_of_halfedges());
+        add_copy();
+        builder.end_surface();
+    }
+
+protected:
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex;
+
+private:
+    void add_copy()
+    {
+        OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
+
+        CGAL::Unique_hash_map<typename Source::Vertex_const_handle, int>
+            vertex_indices;
+        int vertex_index = 0;
+
+        for (typename Source::Vertex_const_iterator vit = source.vertices_begin();
+            vit != source.vertices_end();
+            ++vit, ++vertex_index)
+        {
+            vertex_indices[vit] = vertex_index;
+            add_vertex(vit->point());
+        }
+
+        for (typename Source::Facet_const_iterator fit = source.facets_begin();
+            fit != source.facets_end();
+            ++fit)
+        {
+            typename Source::Halfedge_around_facet_const_circulator
+                hit = fit->facet_begin();
+            typename Source::Halfedge_around_facet_const_circulator
+                hit_end = hit;
+
+            begin_facet();
+            do
+            {
+                add_vertex_to_facet(vertex_indices[hit->vertex()]);
+            } while (++hit != hit_end);
+            end_facet();
+
+            OPERATION_LOG_CODE(
+                ++face_count;
+            )
+        }
+
+        OPERATION_LOG_LEAVE_FUNCTION();
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_POLYHEDRON_COPY_BUILDER_H
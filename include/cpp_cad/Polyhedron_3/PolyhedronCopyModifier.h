@@ -0,0 +1,38 @@
+#ifndef _CPP_CAD_POLYHEDRON_COPY_MODIFIER_H
+#define _CPP_CAD_POLYHEDRON_COPY_MODIFIER_H
+
+#include "../reference_frame.h"
+#include "PolyhedronCopyBuilder.h"
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// A polyhedron modifier that adds a copy of another polyhedron to the
+// polyhedron.
+template <class HDS>
+class PolyhedronCopyModifier : public CGAL::Modifier_base<HDS>
+{
+private:
+    const CGAL::Polyhedron_3<Kernel> &source;
+
+public:
+    inline PolyhedronCopyModifier(
+        const CGAL::Polyhedron_3<Kernel> &source)
+    : source(source),
+        CGAL::Modifier_base<HDS>()
+    {}
+
+    void operator()(HDS& hds)
+    {
+        PolyhedronCopyBuilder<HDS> builder(hds, source);
+
+        builder.run();
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_POLYHEDRON_COPY_MODIFIER_H
@@ -5,23 +5,48 @@
 #include <CGAL/Polyhedron_incremental_builder_3.h>
 
 #include "../Aff_transformation_3.h"
+#include "../IndexedMesh.h"
 #include "../reference_frame.h"
 #include "../Polygon_2.h"
 #include "../Polygon_2_TransformsIterator.h"
+#include "../TessalationTolerance.h"
 #include "../TransformIterator/TransformIterator.h"
 #include "Cube_3_Modifier.h"
 #include "Cylinder_3_TessalationModifier.h"
+#include "Icosphere_3_TessalationModifier.h"
+#include "IndexedMeshModifier.h"
 #include "LinearExtrusionModifier.h"
 #include "PolygonExtrusionModifier.h"
+#include "PolyhedronCopyModifier.h"
+#include "RotateExtrusionTrack.h"
 #include "Sphere_3_TessalationModifier.h"
 
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+    // Selects how spheres are tessalated.
+    enum class SphereTessalation
+    {
+        // Parallel circles, with vertices crowded towards the poles.
+        LATITUDE_LONGITUDE,
+        // A subdivided icosahedron, with triangles of about the same size
+        // everywhere.  It needs fewer vertices for the same chord error.
+        GEODESIC
+    };
+
     class Polyhedron_3 : public CGAL::Polyhedron_3<Kernel>
     {
         public:
 
+        Polyhedron_3()
+        {}
+
+        Polyhedron_3(const CGAL::Polyhedron_3<Kernel> &source)
+        : CGAL::Polyhedron_3<Kernel>(source)
+        {}
+
         static Polyhedron_3 make_cube(Coordinate x_length, Coordinate y_length, Coordinate z_length)
         {
             Polyhedron_3 res;
@@ -63,7 +88,20 @@ namespace cpp_cad
         void add_cube(Coordinate x_length, Coordinate y_length, Coordinate z_length)
         {
             Cube_3_Modifier<Polyhedron_3::HalfedgeDS>
-                modifier(*this, x_length, y_length, z_length);
+                modifier(x_length, y_length, z_length);
+
+            delegate(modifier);
+        }
+
+        // Adds a cube transformed by `placement`.  Transforming the few
+        // vertices is much cheaper than transforming a solid built from
+        // them.
+        void add_cube(
+            Coordinate x_length, Coordinate y_length, Coordinate z_length,
+            const Aff_transformation_3 &placement)
+        {
+            Cube_3_Modifier<Polyhedron_3::HalfedgeDS>
+                modifier(x_length, y_length, z_length, &placement);
 
             delegate(modifier);
         }
@@ -73,23 +111,99 @@ namespace cpp_cad
             int linear_subdivision_c = 2)
         {
             Cylinder_3_TessalationModifier<Polyhedron_3::HalfedgeDS>
-                tessalator(*this, base_r, top_r, height, linear_subdivision_c);
+                tessalator(base_r, top_r, height, linear_subdivision_c);
+
+            delegate(tessalator);
+        }
+
+        void add_cylindrical_tessalation(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            int linear_subdivision_c, const Aff_transformation_3 &placement)
+        {
+            Cylinder_3_TessalationModifier<Polyhedron_3::HalfedgeDS>
+                tessalator(base_r, top_r, height, linear_subdivision_c,
+                    &placement);
 
             delegate(tessalator);
         }
 
-        void add_spherical_tessalation(Coordinate circumsphere_r = 1, int linear_subdivision_c = 2)
+        // Subdivides each end's circle as `tolerance` requires for its
+        // radius.
+        void add_cylindrical_tessalation(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            const TessalationTolerance &tolerance)
         {
-            Sphere_3_TessalationModifier<Polyhedron_3::HalfedgeDS>
-                tessalator(*this, circumsphere_r, linear_subdivision_c);
+            Cylinder_3_TessalationModifier<Polyhedron_3::HalfedgeDS>
+                tessalator(base_r, top_r, height, tolerance);
 
             delegate(tessalator);
         }
 
+        void add_cylindrical_tessalation(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            const TessalationTolerance &tolerance,
+            const Aff_transformation_3 &placement)
+        {
+            Cylinder_3_TessalationModifier<Polyhedron_3::HalfedgeDS>
+                tessalator(base_r, top_r, height, tolerance,
+                    &placement);
+
+            delegate(tessalator);
+        }
+
+        void add_spherical_tessalation(
+            Coordinate circumsphere_r = 1, int linear_subdivision_c = 2,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            add_spherical_tessalation(
+                circumsphere_r, linear_subdivision_c, nullptr, tessalation);
+        }
+
+        void add_spherical_tessalation(
+            Coordinate circumsphere_r, int linear_subdivision_c,
+            const Aff_transformation_3 &placement,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            add_spherical_tessalation(
+                circumsphere_r, linear_subdivision_c, &placement, tessalation);
+        }
+
+        // Subdivides the sphere as coarsely as `tolerance` allows.
+        void add_spherical_tessalation(
+            Coordinate circumsphere_r, const TessalationTolerance &tolerance,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            add_spherical_tessalation(
+                circumsphere_r, tolerance, nullptr, tessalation);
+        }
+
+        void add_spherical_tessalation(
+            Coordinate circumsphere_r, const TessalationTolerance &tolerance,
+            const Aff_transformation_3 &placement,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            add_spherical_tessalation(
+                circumsphere_r, tolerance, &placement, tessalation);
+        }
+
         void add_linear_extrusion(const Polygon_2 &polygon, Kernel::FT height)
         {
             LinearExtrusionModifier<Polyhedron_3::HalfedgeDS>
-                modifier(*this, polygon, height);
+                modifier(polygon, height);
+
+            delegate(modifier);
+        }
+
+        void add_linear_extrusion(
+            const Polygon_2 &polygon, Kernel::FT height,
+            const Aff_transformation_3 &placement)
+        {
+            LinearExtrusionModifier<Polyhedron_3::HalfedgeDS>
+                modifier(polygon, height, &placement);
 
             delegate(modifier);
         }
@@ -98,16 +212,85 @@ namespace cpp_cad
             const Polygon_2 &polygon, double angle = 2 * M_PI,
             int subdivision_c = 16, double eps = 1e-15)
         {
-            Polygon_2 xz_polygon = transform(Aff_transformation_3::swap_yz(), polygon);
-            bool closed = abs(2 * M_PI - abs(angle)) < eps;
-            TransformIterator::ZRotation trajectory(0, angle, subdivision_c, closed);
-            Polygon_2_TransformsIterator<TransformIterator::ZRotation::TransformIterator>
-                track_begin(trajectory.begin(), xz_polygon);
-            Polygon_2_TransformsIterator<TransformIterator::ZRotation::TransformIterator>
-                track_end(trajectory.end(), xz_polygon);
+            add_rotate_extrusion(polygon, angle, subdivision_c, nullptr, eps);
+        }
 
-            add_polygon_extrusion(
-                track_begin, track_end, closed);
+        void add_rotate_extrusion(
+            const Polygon_2 &polygon, double angle, int subdivision_c,
+            const Aff_transformation_3 &placement, double eps = 1e-15)
+        {
+            add_rotate_extrusion(polygon, angle, subdivision_c, &placement, eps);
+        }
+
+        // Subdivides the rotation as `tolerance` requires for the polygon's
+        // farthest vertex from the axis.
+        void add_rotate_extrusion(
+            const Polygon_2 &polygon, double angle,
+            const TessalationTolerance &tolerance, double eps = 1e-15)
+        {
+            add_rotate_extrusion(polygon, angle,
+                rotate_extrusion_subdivision_count(polygon, angle, tolerance, eps),
+                nullptr, eps);
+        }
+
+        void add_rotate_extrusion(
+            const Polygon_2 &polygon, double angle,
+            const TessalationTolerance &tolerance,
+            const Aff_transformation_3 &placement, double eps = 1e-15)
+        {
+            add_rotate_extrusion(polygon, angle,
+                rotate_extrusion_subdivision_count(polygon, angle, tolerance, eps),
+                &placement, eps);
+        }
+
+        // Returns the number of rotation steps, which the polygon's
+        // farthest vertex from the axis needs to meet `tolerance`.
+        static int rotate_extrusion_subdivision_count(
+            const Polygon_2 &polygon, double angle,
+            const TessalationTolerance &tolerance, double eps = 1e-15)
+        {
+            double r = 0;
+
+            for (Polygon_2::Vertex_const_iterator vit = polygon.vertices_begin();
+                vit != polygon.vertices_end();
+                ++vit)
+            {
+                r = std::max(r, std::abs(CGAL::to_double(vit->x())));
+            }
+
+            if (abs(2 * M_PI - abs(angle)) < eps)
+            {
+                return tolerance.circle_subdivision_count(r);
+            }
+
+            return tolerance.arc_subdivision_count(r, angle);
+        }
+
+        // Adds a copy of the vertices and faces of another polyhedron.
+        void add_polyhedron(const CGAL::Polyhedron_3<Kernel> &source)
+        {
+            PolyhedronCopyModifier<Polyhedron_3::HalfedgeDS>
+                modifier(source);
+
+            delegate(modifier);
+        }
+
+        // Adds the vertices, and faces of a mesh in flat arrays, in one
+        // pass, with storage reserved for all of them.
+        void add_indexed_mesh(const IndexedMesh &mesh)
+        {
+            IndexedMeshModifier<Polyhedron_3::HalfedgeDS> modifier(mesh);
+
+            delegate(modifier);
+        }
+
+        void add_indexed_mesh(
+            const IndexedMesh &mesh, const Aff_transformation_3 &placement)
+        {
+            IndexedMeshModifier<Polyhedron_3::HalfedgeDS>
+                modifier(mesh, &placement);
+
+            delegate(modifier);
         }
 
         template<typename PolygonInputIterator>
@@ -116,12 +299,68 @@ namespace cpp_cad
             const PolygonInputIterator &track_end, bool closed = false)
         {
             PolygonExtrusionModifier<Polyhedron_3::HalfedgeDS, PolygonInputIterator>
-                modifier(*this, track_start, track_end, closed);
+                modifier(track_start, track_end, closed);
+
+            delegate(modifier);
+        }
+
+        template<typename PolygonInputIterator>
+        void add_polygon_extrusion(
+            PolygonInputIterator track_start,
+            const PolygonInputIterator &track_end, bool closed,
+            const Aff_transformation_3 &placement)
+        {
+            PolygonExtrusionModifier<Polyhedron_3::HalfedgeDS, PolygonInputIterator>
+                modifier(track_start, track_end, closed, &placement);
+
+            delegate(modifier);
+        }
+
+        private:
+
+        // `subdivision` is a linear subdivision count, or a
+        // `TessalationTolerance`.  `placement` may be null.
+        template <class Subdivision>
+        void add_spherical_tessalation(
+            Coordinate circumsphere_r, const Subdivision &subdivision,
+            const Aff_transformation_3 *placement,
+            SphereTessalation tessalation)
+        {
+            if (tessalation == SphereTessalation::GEODESIC)
+            {
+                Icosphere_3_TessalationModifier<Polyhedron_3::HalfedgeDS>
+                    tessalator(circumsphere_r, subdivision, placement);
+
+                delegate(tessalator);
+            }
+            else
+            {
+                Sphere_3_TessalationModifier<Polyhedron_3::HalfedgeDS>
+                    tessalator(circumsphere_r, subdivision, placement);
+
+                delegate(tessalator);
+            }
+        }
+
+        // `placement` may be null.
+        void add_rotate_extrusion(
+            const Polygon_2 &polygon, double angle, int subdivision_c,
+            const Aff_transformation_3 *placement, double eps)
+        {
+            RotateExtrusionTrack track(polygon, angle, subdivision_c, eps);
+            RotateExtrusionTrack::Iterator track_begin = track.begin();
+            RotateExtrusionTrack::Iterator track_end = track.end();
+
+            PolygonExtrusionModifier<Polyhedron_3::HalfedgeDS,
+                RotateExtrusionTrack::Iterator>
+                modifier(track_begin, track_end, track.is_closed(),
+                    placement);
 
             delegate(modifier);
         }
     };
 }
+}
 
 
 #endif // _CPP_CAD_POLYHEDRON_3_H
\ No newline at end of file
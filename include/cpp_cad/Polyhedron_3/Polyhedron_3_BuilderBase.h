@@ -1,11 +1,26 @@
 #ifndef _CPP_CAD_POLYHEDRON_3_BUILDER_BASE_H
 #define _CPP_CAD_POLYHEDRON_3_BUILDER_BASE_H
 
+#include <cstddef>
+#include <vector>
+
+#include <CGAL/Polyhedron_incremental_builder_3.h>
+
+#include "../Aff_transformation_3.h"
+
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // Common functionality for Polyhedron_3 builders.
-template <class HDS>
+//     The vertices and faces go to a `Sink`, which is constructed from the
+// `HDS`, and has the interface of the incremental builder.  (E.g., a
+// `PointCollector` only collects the vertices.)  Builders only refer to the
+// `HDS`, so adding a primitive to a large polyhedron costs only the added
+// elements.
+template <class HDS,
+    class Sink = CGAL::Polyhedron_incremental_builder_3<HDS>>
 class Polyhedron_3_BuilderBase : public CGAL::Modifier_base<HDS>
 {
 protected:
@@ -13,27 +28,93 @@ protected:
         int vertex_count;
         int face_count;
     )
-    CGAL::Polyhedron_3<Kernel> polyhedron;
-    CGAL::Polyhedron_incremental_builder_3<HDS> builder;
+    Sink builder;
+    // Transformation applied to every added vertex, if `is_placed`:
+    Aff_transformation_3 placement;
+    bool is_placed;
+    // Whether the placement is a reflection, which reverses the faces'
+    // vertices:
+    bool is_reflected;
+    // The vertices of the current face of a reflected polyhedron:
+    std::vector<std::size_t> facet_vertices;
 
 public:
-    inline Polyhedron_3_BuilderBase(
-        CGAL::Polyhedron_3<Kernel> &polyhedron, HDS& hds)
+    inline Polyhedron_3_BuilderBase(HDS& hds)
     : OPERATION_LOG_CODE(
             vertex_count(0),
             face_count(0),
       )
-        polyhedron(polyhedron),
         builder(hds, true),
+        is_placed(false),
+        is_reflected(false),
         CGAL::Modifier_base<HDS>()
     {}
 
+    // Places the built polyhedron, by transforming its vertices as they're
+    // added.  The faces of a reflection are added in reverse, so that they
+    // still face outwards.
+    inline void set_placement(const Aff_transformation_3 &placement)
+    {
+        this->placement = placement;
+        is_placed = true;
+        is_reflected = placement.is_odd();
+    }
+
+    // True, if the sink rejected a face, or a vertex index.
+    inline bool error() const
+    {
+        return builder.error();
+    }
+
     // Required when deriving from CGAL::Modifier_base<HDS> to make this class
     // not abstract:
     void operator()(HDS& hds)
     {}
 
 protected:
+    // Faces are added through the following methods, instead of the
+    // builder's, which reverse the faces of reflected polyhedra.
+
+    inline void begin_facet()
+    {
+        if (is_reflected)
+        {
+            facet_vertices.clear();
+        }
+        else
+        {
+            builder.begin_facet();
+        }
+    }
+
+    inline void add_vertex_to_facet(std::size_t vertex_index)
+    {
+        if (is_reflected)
+        {
+            facet_vertices.push_back(vertex_index);
+        }
+        else
+        {
+            builder.add_vertex_to_facet(vertex_index);
+        }
+    }
+
+    inline void end_facet()
+    {
+        if (is_reflected)
+        {
+            builder.begin_facet();
+            for (std::vector<std::size_t>::const_reverse_iterator vit =
+                    facet_vertices.rbegin();
+                vit != facet_vertices.rend();
+                ++vit)
+            {
+                builder.add_vertex_to_facet(*vit);
+            }
+        }
+        builder.end_facet();
+    }
+
     // Adds a triangular face to the polyhedron.
     //     The vertices must have already been added.
     inline void add_face(int v0_index, int v1_index, int v2_index)
@@ -45,11 +126,11 @@ protected:
             v1_index << " " <<
             v2_index);
 
-        builder.begin_facet();
-        builder.add_vertex_to_facet(v0_index);
-        builder.add_vertex_to_facet(v1_index);
-        builder.add_vertex_to_facet(v2_index);
-        builder.end_facet();
+        begin_facet();
+        add_vertex_to_facet(v0_index);
+        add_vertex_to_facet(v1_index);
+        add_vertex_to_facet(v2_index);
+        end_facet();
 
         OPERATION_LOG_CODE(
             ++face_count;
@@ -70,12 +151,12 @@ protected:
             v2_index << " " <<
             v3_index);
 
-        builder.begin_facet();
-        builder.add_vertex_to_facet(v0_index);
-        builder.add_vertex_to_facet(v1_index);
-        builder.add_vertex_to_facet(v2_index);
-        builder.add_vertex_to_facet(v3_index);
-        builder.end_facet();
+        begin_facet();
+        add_vertex_to_facet(v0_index);
+        add_vertex_to_facet(v1_index);
+        add_vertex_to_facet(v2_index);
+        add_vertex_to_facet(v3_index);
+        end_facet();
 
         OPERATION_LOG_CODE(
             ++face_count;
@@ -90,6 +171,11 @@ protected:
 
         Kernel::Point_3 point(x, y, z);
 
+        if (is_placed)
+        {
+            point = placement.transform(point);
+        }
+
         OPERATION_LOG_MESSAGE_STREAM(<<
             "Vertex " << vertex_count << ": " << point);
 
@@ -109,7 +195,7 @@ protected:
         OPERATION_LOG_MESSAGE_STREAM(<<
             "Vertex " << vertex_count << ": " << point);
 
-        builder.add_vertex(point);
+        builder.add_vertex(is_placed ? placement.transform(point) : point);
 
         OPERATION_LOG_CODE(
             vertex_count++;
@@ -120,6 +206,7 @@ protected:
 };
 
 
+}
 }
 
 #endif // _CPP_CAD_POLYHEDRON_3_BUILDER_BASE_H
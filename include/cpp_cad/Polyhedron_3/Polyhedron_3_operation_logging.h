@@ -190,6 +190,13 @@ class ValueFormatter<cpp_cad::Aff_transformation_3> : public ValueFormatterI
 namespace cpp_cad_log
 {
 
+// Builder sinks other than the incremental builder (e.g., point collectors)
+// have no halfedge data structure to log.
+template <class Sink>
+void log_polyhedron_builder_vertices(
+    Sink &builder, int vertex_count, std::string extra_code = "")
+{}
+
 template <class HDS>
 void log_polyhedron_builder_vertices(
     CGAL::Polyhedron_incremental_builder_3<HDS> &builder, int vertex_count,
@@ -0,0 +1,63 @@
+#ifndef _CPP_CAD_ROTATE_EXTRUSION_TRACK_H
+#define _CPP_CAD_ROTATE_EXTRUSION_TRACK_H
+
+#include <cmath>
+
+#include "../Aff_transformation_3.h"
+#include "../Polygon_2.h"
+#include "../Polygon_2_TransformsIterator.h"
+#include "../TransformIterator/TransformIterator.h"
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// The track of a rotate extrusion for a `PolygonExtrusionBuilder`: the
+// polygon's copies rotated about the z axis.  The polygon's y axis becomes
+// the z axis.
+//     The track's iterators refer to it, so it can't be copied.
+class RotateExtrusionTrack
+{
+public:
+    typedef Polygon_2_TransformsIterator<
+        TransformIterator::ZRotation::TransformIterator> Iterator;
+
+private:
+    Polygon_2 xz_polygon;
+    // True, if the rotation is a full turn:
+    bool closed;
+    TransformIterator::ZRotation trajectory;
+
+public:
+    inline RotateExtrusionTrack(
+        const Polygon_2 &polygon, double angle, int subdivision_c,
+        double eps = 1e-15)
+    : xz_polygon(transform(Aff_transformation_3::swap_yz(), polygon)),
+        closed(std::abs(2 * M_PI - std::abs(angle)) < eps),
+        trajectory(0, angle, subdivision_c, closed)
+    {}
+
+    RotateExtrusionTrack(const RotateExtrusionTrack &) = delete;
+    RotateExtrusionTrack &operator=(const RotateExtrusionTrack &) = delete;
+
+    inline Iterator begin()
+    {
+        return Iterator(trajectory.begin(), xz_polygon);
+    }
+
+    inline Iterator end()
+    {
+        return Iterator(trajectory.end(), xz_polygon);
+    }
+
+    inline bool is_closed() const
+    {
+        return closed;
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_ROTATE_EXTRUSION_TRACK_H
@@ -4,35 +4,47 @@
 
 #include <algorithm>
 #include <cassert>
+#include <memory>
 #include <operation_log.h>
 
+#include "../TessalationTolerance.h"
+#include "CircleTable.h"
 #include "Polyhedron_3_BuilderBase.h"
 #include "Sphere_3_operation_logging.h"
 
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A class that uses a polyhedron incremental builer to build the faces of a
 // sphere tessalation.
-template <class HDS>
-class Sphere_3_TessalationBuilder : public Polyhedron_3_BuilderBase<HDS>
+template <class HDS,
+    class Sink = CGAL::Polyhedron_incremental_builder_3<HDS>>
+class Sphere_3_TessalationBuilder : public Polyhedron_3_BuilderBase<HDS, Sink>
 {
 protected:
-    using Polyhedron_3_BuilderBase<HDS>::builder;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::builder;
     OPERATION_LOG_CODE(
-        using Polyhedron_3_BuilderBase<HDS>::vertex_count;
+        using Polyhedron_3_BuilderBase<HDS, Sink>::vertex_count;
     )
 
 private:
     double circumsphere_r;
     int linear_subdivisions;
-    double latitude;
+    // Replaces `linear_subdivisions`, if set.  The meridian, and each
+    // parallel circle are then subdivided as the tolerance requires for
+    // their radii:
+    TessalationTolerance tolerance;
+    // The angles of the meridian are multiples of `latitude_step` from the
+    // south pole, and the angles of the current parallel circle are
+    // multiples of 2 pi / `parallel_subdivision_c`:
+    std::shared_ptr<const CircleTable> meridian_table;
+    std::shared_ptr<const CircleTable> parallel_table;
     double latitude_step;
-    double longitude;
-    double longitude_step;
-    double prev_longitude;
-    double prev_longitude_step;
+    int latitude_i;
+    int longitude_i;
     double parallel_r; // Radius of the current parallel circle.
     int half_meridian_subdivision_c;
     int parallel_subdivision_c;
@@ -49,10 +61,12 @@ private:
     int longitude_difference_subdiv;
 
 public:
-    inline Sphere_3_TessalationBuilder(CGAL::Polyhedron_3<Kernel> &polyhedron, HDS& hds, Kernel::FT circumsphere_r = 1, int linear_subdivisions = 2)
+    inline Sphere_3_TessalationBuilder(HDS& hds, Kernel::FT circumsphere_r = 1, int linear_subdivisions = 2,
+        const TessalationTolerance &tolerance = TessalationTolerance())
     : circumsphere_r(CGAL::to_double(circumsphere_r)),
         linear_subdivisions(linear_subdivisions),
-        Polyhedron_3_BuilderBase<HDS>(polyhedron, hds)
+        tolerance(tolerance),
+        Polyhedron_3_BuilderBase<HDS, Sink>(hds)
     {}
 
     void run()
@@ -68,21 +82,18 @@ public:
         int prev_vertex_c = 1;
 
         // Subdivide a half meridian in, at least, 3 parts:
-        half_meridian_subdivision_c =
-            std::max(3, (linear_subdivisions + 1) / 2);
+        half_meridian_subdivision_c = std::max(3, tolerance.is_set() ?
+            tolerance.arc_subdivision_count(circumsphere_r, M_PI) :
+            (linear_subdivisions + 1) / 2);
 
         latitude_step = M_PI / half_meridian_subdivision_c;
-        double latitude = -CGAL_M_PI_2 + latitude_step;
+        meridian_table = CircleTable::get(2 * half_meridian_subdivision_c);
 
         for (int parallel_c = 2;
             parallel_c <= half_meridian_subdivision_c;
-            ++parallel_c, latitude += latitude_step)
+            ++parallel_c)
         {
-            // Subdivide each parallel into, at least, 3 parts:
-            parallel_subdivision_c = std::max(
-                3,
-                static_cast<int>(ceil(cos(latitude) * linear_subdivisions)));
-            int vertex_c = parallel_subdivision_c;
+            int vertex_c = parallel_subdivision_count(parallel_c - 1);
 
             vertex_count += vertex_c;
             face_count += prev_vertex_c + vertex_c;
@@ -103,45 +114,39 @@ public:
     }
 
 protected:
-    using Polyhedron_3_BuilderBase<HDS>::add_face;
+    using Polyhedron_3_BuilderBase<HDS, Sink>::add_face;
 
 private:
     void add_tessalation()
     {
         OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
 
-        longitude_step = 2 * M_PI / parallel_subdivision_c;
-
-        latitude = -CGAL_M_PI_2;
+        latitude_i = 0;
         parallel_r = 0.0;
         prev_parallel_vertex_i = 0;
         add_first_parallel();
 
-        latitude += latitude_step;
-        parallel_r = circumsphere_r * cos(latitude);
+        latitude_i = 1;
+        parallel_r = parallel_radius(latitude_i);
         prev_parallel_subdivision_c = parallel_subdivision_c;
         prev_parallel_last_vertex_i = parallel_last_vertex_i;
         add_second_parallel();
 
         // Add the remaining parallel circles, except the last pole:
-        latitude += latitude_step;
-        for (int parallel_c = 3;
-            parallel_c <= half_meridian_subdivision_c;
-            ++parallel_c, latitude += latitude_step)
+        for (latitude_i = 2;
+            latitude_i < half_meridian_subdivision_c;
+            ++latitude_i)
         {
-            parallel_r = circumsphere_r * cos(latitude);
-            prev_longitude = 0;
+            parallel_r = parallel_radius(latitude_i);
             prev_parallel_subdivision_c = parallel_subdivision_c;
-            prev_longitude_step = longitude_step;
             prev_parallel_last_vertex_i = parallel_last_vertex_i;
 
             add_parallel();
         }
 
+        latitude_i = half_meridian_subdivision_c;
         parallel_r = 0.0;
-        prev_longitude = 0;
         prev_parallel_subdivision_c = parallel_subdivision_c;
-        prev_longitude_step = longitude_step;
         prev_parallel_last_vertex_i = parallel_last_vertex_i;
         add_last_parallel();
 
@@ -153,8 +158,10 @@ private:
     {
         OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
 
-        add_vertex(-CGAL_M_PI_2, 0);
         parallel_subdivision_c = 1;
+        parallel_table = CircleTable::get(parallel_subdivision_c);
+        longitude_i = 0;
+        add_vertex();
         parallel_last_vertex_i = 0;
         parallel_vertex_i = 1;
 
@@ -166,21 +173,20 @@ private:
     {
         OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
 
-        // Subdivide each parallel into, at least, 3 parts:
-        parallel_subdivision_c = std::max(
-            3, static_cast<int>(ceil(cos(latitude) * linear_subdivisions)));
-        longitude_step = 2*M_PI / parallel_subdivision_c;
+        parallel_subdivision_c = parallel_subdivision_count(latitude_i);
+        parallel_table = CircleTable::get(parallel_subdivision_c);
         parallel_last_vertex_i = parallel_vertex_i + parallel_subdivision_c - 1;
 
         // Add the first vertex for the current parallel:
-        add_vertex(latitude, 0);
+        longitude_i = 0;
+        add_vertex();
         ++parallel_vertex_i;
 
-        for (longitude = longitude_step;
+        for (longitude_i = 1;
             parallel_vertex_i <= parallel_last_vertex_i;
-            ++parallel_vertex_i, longitude += longitude_step)
+            ++parallel_vertex_i, ++longitude_i)
         {
-            add_vertex(latitude, longitude);
+            add_vertex();
 
             add_face(
                 prev_parallel_vertex_i,
@@ -204,10 +210,12 @@ private:
         OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
 
         parallel_subdivision_c = 1;
+        parallel_table = CircleTable::get(parallel_subdivision_c);
         parallel_last_vertex_i = parallel_vertex_i + parallel_subdivision_c - 1;
 
         // Add the pole:
-        add_vertex(CGAL_M_PI_2, 0);
+        longitude_i = 0;
+        add_vertex();
 
         // Add the faces:
         for (++prev_parallel_vertex_i;
@@ -233,19 +241,18 @@ private:
     {
         OPERATION_LOG_ENTER_NO_ARG_FUNCTION();
 
-        // Subdivide each parallel into, at least, 3 parts:
-        parallel_subdivision_c = std::max(
-            3, static_cast<int>(ceil(cos(latitude) * linear_subdivisions)));
-        longitude_step = 2*M_PI / parallel_subdivision_c;
+        parallel_subdivision_c = parallel_subdivision_count(latitude_i);
+        parallel_table = CircleTable::get(parallel_subdivision_c);
         parallel_last_vertex_i = parallel_vertex_i + parallel_subdivision_c - 1;
 
-        OPERATION_LOG_DUMP_VARS(latitude, parallel_subdivision_c,
-            longitude_step, prev_parallel_vertex_i, parallel_vertex_i,
+        OPERATION_LOG_DUMP_VARS(latitude_i, parallel_subdivision_c,
+            prev_parallel_vertex_i, parallel_vertex_i,
             prev_parallel_last_vertex_i, parallel_last_vertex_i);
 
         // Add the first vertex for the current longitude circle:
-        add_vertex(latitude, 0);
-        longitude = longitude_step;
+        longitude_i = 0;
+        add_vertex();
+        longitude_i = 1;
 
         longitude_difference_subdiv = 0;
 
@@ -318,10 +325,10 @@ private:
         }
         else
         {
-            OPERATION_LOG_DUMP_VARS(latitude, longitude, longitude_step);
+            OPERATION_LOG_DUMP_VARS(latitude_i, longitude_i);
 
-            add_vertex(latitude, longitude);
-            longitude += longitude_step;
+            add_vertex();
+            ++longitude_i;
         }
 
         assert(next_vertex_i != parallel_vertex_i);
@@ -405,8 +412,8 @@ private:
             {
                 OPERATION_LOG_MESSAGE("Adding next vertex.");
 
-                add_vertex(latitude, longitude);
-                longitude += longitude_step;
+                add_vertex();
+                ++longitude_i;
             }
 
             add_face(prev_vertex_i, next_vertex_i, prev_parallel_vertex_i);
@@ -417,34 +424,51 @@ private:
         OPERATION_LOG_LEAVE_FUNCTION();
     }
 
-    inline void add_vertex(double latitude, double longitude)
+    // Subdivide each parallel into, at least, 3 parts:
+    inline int parallel_subdivision_count(int latitude_i) const
+    {
+        if (tolerance.is_set())
+        {
+            return tolerance.circle_subdivision_count(
+                parallel_radius(latitude_i));
+        }
+
+        return std::max(3, static_cast<int>(
+            ceil(meridian_table->sin(latitude_i) * linear_subdivisions)));
+    }
+
+    // The cosine of the latitude is the sine of the angle from the south
+    // pole:
+    inline double parallel_radius(int latitude_i) const
     {
-        OPERATION_LOG_ENTER_FUNCTION(latitude / M_PI, longitude / M_PI);
+        return circumsphere_r * meridian_table->sin(latitude_i);
+    }
 
-        assert(abs(parallel_r - circumsphere_r * cos(latitude)) < 1e-15);
+    // Adds the vertex at `latitude_i`, and `longitude_i`.
+    inline void add_vertex()
+    {
+        OPERATION_LOG_ENTER_FUNCTION(latitude_i, longitude_i);
 
         Kernel::Point_3 point(
-                parallel_r * cos(longitude),
-                parallel_r * sin(longitude),
-                circumsphere_r * sin(latitude)
+                parallel_r * parallel_table->cos(longitude_i),
+                parallel_r * parallel_table->sin(longitude_i),
+                -circumsphere_r * meridian_table->cos(latitude_i)
             );
 
-        OPERATION_LOG_MESSAGE_STREAM(<<
-            "Vertex " << vertex_count << ": " << point);
-
-        builder.add_vertex(point);
+        // The base class places, and counts the vertex:
+        Polyhedron_3_BuilderBase<HDS, Sink>::add_vertex(point);
 
         OPERATION_LOG_CODE(
-            vertex_count++;
-
             cpp_cad_log::log_sphere_tessalation_builder_vertices(
-                circumsphere_r, latitude_step, latitude, builder, vertex_count);
+                circumsphere_r, latitude_step,
+                latitude_i * latitude_step - CGAL_M_PI_2, builder, vertex_count);
         )
 
         OPERATION_LOG_LEAVE_FUNCTION();
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_SPHERE_3_TESSALATION_BUILDER_H
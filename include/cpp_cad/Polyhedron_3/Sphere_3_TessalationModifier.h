@@ -6,6 +6,8 @@
 
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // A polyhedron modifier that adds a tessalation of a sphere to the polyhedron.
 template <class HDS>
@@ -14,24 +16,45 @@ class Sphere_3_TessalationModifier : public CGAL::Modifier_base<HDS>
 private:
     Kernel::FT circumsphere_r;
     int linear_subdivisions;
-    CGAL::Polyhedron_3<Kernel> polyhedron;
+    // Replaces `linear_subdivisions`, if set:
+    TessalationTolerance tolerance;
+    // Null, if the built polyhedron stays in place:
+    const Aff_transformation_3 *placement;
 
 public:
-    inline Sphere_3_TessalationModifier(CGAL::Polyhedron_3<Kernel> &polyhedron, Kernel::FT circumsphere_r = 1, int linear_subdivisions = 2)
+    inline Sphere_3_TessalationModifier(Kernel::FT circumsphere_r = 1, int linear_subdivisions = 2,
+        const Aff_transformation_3 *placement = nullptr)
     : circumsphere_r(circumsphere_r),
         linear_subdivisions(linear_subdivisions),
-        polyhedron(polyhedron),
+        placement(placement),
+        CGAL::Modifier_base<HDS>()
+    {}
+
+    inline Sphere_3_TessalationModifier(Kernel::FT circumsphere_r,
+        const TessalationTolerance &tolerance,
+        const Aff_transformation_3 *placement = nullptr)
+    : circumsphere_r(circumsphere_r),
+        linear_subdivisions(0),
+        tolerance(tolerance),
+        placement(placement),
         CGAL::Modifier_base<HDS>()
     {}
 
     void operator()(HDS& hds)
     {
-        Sphere_3_TessalationBuilder<HDS> builder(polyhedron, hds, circumsphere_r, linear_subdivisions);
+        Sphere_3_TessalationBuilder<HDS> builder(hds, circumsphere_r, linear_subdivisions,
+            tolerance);
+
+        if (placement != nullptr)
+        {
+            builder.set_placement(*placement);
+        }
 
         builder.run();
     }
 };
 
+}
 }
 
 #endif // _CPP_CAD_SPHERE_3_TESSALATION_MODIFIER_H
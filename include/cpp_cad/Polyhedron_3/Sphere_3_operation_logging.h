@@ -16,10 +16,10 @@ namespace cpp_cad_log
 
 #ifdef OPERATION_LOG
 
-template <class HDS>
+template <class Builder>
 void log_sphere_tessalation_builder_vertices(
     double circumsphere_r, double latitude_step, double max_latitude,
-    CGAL::Polyhedron_incremental_builder_3<HDS> &builder, int vertex_count,
+    Builder &builder, int vertex_count,
     std::string extra_code = "")
 {
     std::stringstream extra_code_buf(extra_code);
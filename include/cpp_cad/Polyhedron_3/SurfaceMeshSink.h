@@ -0,0 +1,88 @@
+#ifndef _CPP_CAD_SURFACE_MESH_SINK_H
+#define _CPP_CAD_SURFACE_MESH_SINK_H
+
+#include <vector>
+
+#include <CGAL/Surface_mesh.h>
+
+#include "../reference_frame.h"
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// A builder sink that adds the vertices, and faces to a `CGAL::Surface_mesh`.
+//     Builders, whose `HDS` is a surface mesh, and whose `Sink` is a
+// `SurfaceMeshSink`, fill the mesh's index-based arrays, without building a
+// pointer-linked halfedge data structure.  Like the incremental builder, the
+// facets' vertex indices count from the first vertex of the surface.
+class SurfaceMeshSink
+{
+public:
+    typedef CGAL::Surface_mesh<Point_3> Mesh;
+    typedef std::size_t size_type;
+
+private:
+    Mesh &mesh;
+    size_type first_vertex_i;
+    std::vector<Mesh::Vertex_index> facet;
+    bool has_error;
+
+public:
+    inline SurfaceMeshSink(Mesh &mesh, bool verbose = false)
+    : mesh(mesh),
+        first_vertex_i(mesh.number_of_vertices()),
+        has_error(false)
+    {}
+
+    inline void begin_surface(
+        size_type vertex_count, size_type face_count,
+        size_type halfedge_count = 0)
+    {
+        first_vertex_i = mesh.number_of_vertices();
+        mesh.reserve(
+            mesh.number_of_vertices() + vertex_count,
+            mesh.number_of_edges() + halfedge_count / 2,
+            mesh.number_of_faces() + face_count);
+    }
+
+    inline void add_vertex(const Point_3 &point)
+    {
+        mesh.add_vertex(point);
+    }
+
+    inline void begin_facet()
+    {
+        facet.clear();
+    }
+
+    inline void add_vertex_to_facet(size_type vertex_index)
+    {
+        facet.push_back(Mesh::Vertex_index(
+            static_cast<Mesh::size_type>(first_vertex_i + vertex_index)));
+    }
+
+    // Adds the facet.  Facets, which would make the mesh non-manifold, are
+    // skipped, and flag an error.
+    inline void end_facet()
+    {
+        if (mesh.add_face(facet) == Mesh::null_face())
+        {
+            has_error = true;
+        }
+    }
+
+    inline void end_surface()
+    {}
+
+    inline bool error() const
+    {
+        return has_error;
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_SURFACE_MESH_SINK_H
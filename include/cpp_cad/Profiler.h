@@ -0,0 +1,347 @@
+#ifndef _CPP_CAD_PROFILER_H
+#define _CPP_CAD_PROFILER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __unix__
+#include <sys/resource.h>
+#endif
+
+
+namespace cpp_cad
+{
+
+// The sizes of a solid's SNC, or of a mesh.  Meshes have no volumes.
+//     `of()` is overloaded for Nef polyhedra, polyhedral surfaces, and
+// surface meshes, by the functions that only they have.
+struct SolidSize
+{
+    long long vertex_count;
+    long long halfedge_count;
+    long long facet_count;
+    long long volume_count;
+
+    SolidSize()
+    : vertex_count(0),
+        halfedge_count(0),
+        facet_count(0),
+        volume_count(0)
+    {}
+
+    template <class Nef>
+    static auto of(const Nef &solid) ->
+        decltype(solid.number_of_volumes(), SolidSize())
+    {
+        SolidSize res;
+
+        res.vertex_count = solid.number_of_vertices();
+        res.halfedge_count = solid.number_of_halfedges();
+        res.facet_count = solid.number_of_facets();
+        res.volume_count = solid.number_of_volumes();
+
+        return res;
+    }
+
+    template <class Polyhedron>
+    static auto of(const Polyhedron &polyhedron) ->
+        decltype(polyhedron.size_of_facets(), SolidSize())
+    {
+        SolidSize res;
+
+        res.vertex_count = polyhedron.size_of_vertices();
+        res.halfedge_count = polyhedron.size_of_halfedges();
+        res.facet_count = polyhedron.size_of_facets();
+
+        return res;
+    }
+
+    template <class Mesh>
+    static auto of(const Mesh &mesh) ->
+        decltype(mesh.number_of_faces(), SolidSize())
+    {
+        SolidSize res;
+
+        res.vertex_count = mesh.number_of_vertices();
+        res.halfedge_count = mesh.number_of_halfedges();
+        res.facet_count = mesh.number_of_faces();
+
+        return res;
+    }
+
+    void write_json(std::ostream &out) const
+    {
+        out << "{\"vertices\": " << vertex_count <<
+            ", \"halfedges\": " << halfedge_count <<
+            ", \"facets\": " << facet_count <<
+            ", \"volumes\": " << volume_count << "}";
+    }
+};
+
+// One profiled call.
+struct ProfileRecord
+{
+    std::string operation;
+    // A small number per thread, in the order threads were first profiled:
+    unsigned thread;
+    // The number of enclosing profiled calls on the same thread:
+    unsigned depth;
+    // Microseconds since the profiler was enabled:
+    long long start_us;
+    long long wall_us;
+    std::vector<SolidSize> inputs;
+    bool has_output;
+    SolidSize output;
+    // The growth of the process' peak resident set size during the call.
+    // Concurrent calls share the growth, so it's approximate with several
+    // threads:
+    long long peak_rss_delta_kb;
+
+    void write_json(std::ostream &out) const
+    {
+        out << "{\"operation\": \"" << operation <<
+            "\", \"thread\": " << thread <<
+            ", \"depth\": " << depth <<
+            ", \"start_us\": " << start_us <<
+            ", \"wall_us\": " << wall_us <<
+            ", \"inputs\": [";
+        for (std::size_t i = 0; i < inputs.size(); ++i)
+        {
+            if (i > 0)
+            {
+                out << ", ";
+            }
+            inputs[i].write_json(out);
+        }
+        out << "], \"output\": ";
+        if (has_output)
+        {
+            output.write_json(out);
+        }
+        else
+        {
+            out << "null";
+        }
+        out << ", \"peak_rss_delta_kb\": " << peak_rss_delta_kb << "}";
+    }
+};
+
+// Records the costs of the library's geometry operations, and reports them
+// as JSON.
+//     Profiling is off by default, and then costs a relaxed atomic load per
+// operation.  Setting the environment variable CPP_CAD_PROFILE to a path
+// turns the shared profiler on, and writes its report to the path at exit.
+class Profiler
+{
+private:
+    std::atomic<bool> enabled;
+    std::chrono::steady_clock::time_point start_time;
+    std::vector<ProfileRecord> records;
+    std::mutex records_mutex;
+    std::atomic<unsigned> thread_count;
+    // Written at destruction, if not empty:
+    std::string report_path;
+
+public:
+    Profiler()
+    : enabled(false),
+        start_time(std::chrono::steady_clock::now()),
+        thread_count(0)
+    {}
+
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+
+    ~Profiler()
+    {
+        if (!report_path.empty())
+        {
+            write_json_file(report_path);
+        }
+    }
+
+    // The profiler of the library's operations.
+    static Profiler &shared()
+    {
+        static Profiler res(std::getenv("CPP_CAD_PROFILE"));
+
+        return res;
+    }
+
+    inline bool is_enabled() const
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    // Turns profiling on, or off.  Turning it on restarts the clock, so do
+    // it while no profiled calls run.
+    void set_enabled(bool is_enabled)
+    {
+        if (is_enabled && !this->is_enabled())
+        {
+            start_time = std::chrono::steady_clock::now();
+        }
+        enabled = is_enabled;
+    }
+
+    void add(ProfileRecord record)
+    {
+        std::lock_guard<std::mutex> lock(records_mutex);
+
+        records.push_back(std::move(record));
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(records_mutex);
+
+        records.clear();
+    }
+
+    // Returns the microseconds since the profiler was enabled.
+    long long now_us() const
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start_time).count();
+    }
+
+    // Returns the profiler's number for the calling thread.
+    unsigned thread_number()
+    {
+        static thread_local unsigned res = thread_count++;
+
+        return res;
+    }
+
+    // Returns the process' peak resident set size in kilobytes, or 0, if
+    // unknown.
+    static long long peak_rss_kb()
+    {
+    #ifdef __unix__
+        struct rusage usage;
+
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            return usage.ru_maxrss;
+        }
+    #endif
+
+        return 0;
+    }
+
+    // Writes the records in the order the calls finished.
+    void write_json(std::ostream &out)
+    {
+        std::lock_guard<std::mutex> lock(records_mutex);
+
+        out << "{\"records\": [";
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            out << (i > 0 ? ",\n    " : "\n    ");
+            records[i].write_json(out);
+        }
+        out << "\n]}\n";
+    }
+
+    void write_json_file(const std::string &path)
+    {
+        std::ofstream out(path);
+
+        write_json(out);
+    }
+
+private:
+    explicit Profiler(const char *report_path)
+    : Profiler()
+    {
+        if (report_path != nullptr && *report_path != '\0')
+        {
+            this->report_path = report_path;
+            enabled = true;
+        }
+    }
+};
+
+// Profiles a call for the scope's lifetime, if the shared profiler is
+// enabled when the scope starts.
+class ProfileScope
+{
+private:
+    Profiler *profiler;
+    ProfileRecord record;
+    long long start_rss_kb;
+
+    static unsigned &thread_depth()
+    {
+        static thread_local unsigned res = 0;
+
+        return res;
+    }
+
+public:
+    explicit ProfileScope(const char *operation)
+    : profiler(Profiler::shared().is_enabled() ? &Profiler::shared() : nullptr)
+    {
+        if (profiler == nullptr)
+        {
+            return;
+        }
+
+        record.operation = operation;
+        record.thread = profiler->thread_number();
+        record.depth = thread_depth()++;
+        record.has_output = false;
+        start_rss_kb = Profiler::peak_rss_kb();
+        record.start_us = profiler->now_us();
+    }
+
+    ProfileScope(const ProfileScope &) = delete;
+    ProfileScope &operator=(const ProfileScope &) = delete;
+
+    ~ProfileScope()
+    {
+        if (profiler == nullptr)
+        {
+            return;
+        }
+
+        record.wall_us = profiler->now_us() - record.start_us;
+        record.peak_rss_delta_kb = Profiler::peak_rss_kb() - start_rss_kb;
+        --thread_depth();
+        profiler->add(std::move(record));
+    }
+
+    template <class Solid>
+    void add_input(const Solid &solid)
+    {
+        if (profiler != nullptr)
+        {
+            record.inputs.push_back(SolidSize::of(solid));
+        }
+    }
+
+    // Records the call's result, and returns it.
+    template <class Solid>
+    const Solid &output(const Solid &solid)
+    {
+        if (profiler != nullptr)
+        {
+            record.output = SolidSize::of(solid);
+            record.has_output = true;
+        }
+
+        return solid;
+    }
+};
+
+}
+
+#endif // _CPP_CAD_PROFILER_H
@@ -0,0 +1,731 @@
+#ifndef _CPP_CAD_SOLID_CACHE_H
+#define _CPP_CAD_SOLID_CACHE_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <utime.h>
+
+#include <CGAL/IO/Nef_polyhedron_iostream_3.h>
+
+#include "Aff_transformation_3.h"
+#include "Nef_polyhedron_3.h"
+#include "Polygon_2.h"
+#include "reference_frame.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// A 128-bit structural hash.
+//     `index` locates entries in tables.  `check` is an independent hash of
+// the same key, which is compared on lookup, so that a collision of `index`
+// alone doesn't return the wrong solid.
+struct StructuralHash
+{
+    std::uint64_t index;
+    std::uint64_t check;
+
+    inline bool operator==(const StructuralHash &rhs) const
+    {
+        return index == rhs.index && check == rhs.check;
+    }
+
+    inline bool operator!=(const StructuralHash &rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+    inline bool operator<(const StructuralHash &rhs) const
+    {
+        return index < rhs.index || (index == rhs.index && check < rhs.check);
+    }
+
+    // The hasher of unordered containers:
+    struct Hasher
+    {
+        inline std::size_t operator()(const StructuralHash &hash) const
+        {
+            return hash.index;
+        }
+    };
+};
+
+// Builds the canonical text of a construction step, and its hash.
+//     Exact coordinates are written exactly, and doubles in hexadecimal, so
+// equal keys mean equal parameters.  The hash is stable across processes.
+class StructuralKey
+{
+private:
+    std::ostringstream text;
+
+public:
+    explicit StructuralKey(const std::string &operation)
+    {
+        text << std::hexfloat << operation;
+    }
+
+    template <class Value>
+    StructuralKey &add(const Value &value)
+    {
+        text << ' ' << value;
+
+        return *this;
+    }
+
+    StructuralKey &add(const StructuralHash &hash)
+    {
+        return add(hash.index).add(hash.check);
+    }
+
+    StructuralKey &add(const Kernel::FT &value)
+    {
+        text << ' ' << CGAL::exact(value);
+
+        return *this;
+    }
+
+    StructuralKey &add(const Point_3 &point)
+    {
+        return add(point.x()).add(point.y()).add(point.z());
+    }
+
+    StructuralKey &add(const CGAL::Aff_transformation_3<Kernel> &transformation)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            for (int j = 0; j < 4; ++j)
+            {
+                add(transformation.m(i, j));
+            }
+        }
+
+        return *this;
+    }
+
+    StructuralKey &add(const Polygon_2 &polygon)
+    {
+        add(polygon.size());
+
+        for (Polygon_2::Vertex_const_iterator vit = polygon.vertices_begin();
+            vit != polygon.vertices_end();
+            ++vit)
+        {
+            add(*vit);
+        }
+
+        return *this;
+    }
+
+    inline std::string str() const
+    {
+        return text.str();
+    }
+
+    // Returns the 64-bit FNV-1a hash of the key, and a multiply, and
+    // xor-shift hash of it as the check.
+    StructuralHash hash() const
+    {
+        StructuralHash res = { 14695981039346656037ULL, 0 };
+
+        for (unsigned char c : text.str())
+        {
+            res.index ^= c;
+            res.index *= 1099511628211ULL;
+            res.check = (res.check ^ c) * 0x9e3779b97f4a7c15ULL;
+            res.check ^= res.check >> 29;
+        }
+
+        return res;
+    }
+};
+
+// Counters for sizing a SolidCache.
+struct SolidCacheStatistics
+{
+    unsigned long hit_count;
+    unsigned long miss_count;
+    unsigned long eviction_count;
+    std::size_t entry_count;
+    // Estimated bytes held by the cached solids:
+    std::size_t memory_footprint;
+    // Solids loaded from, and written to the cache directory:
+    unsigned long disk_hit_count;
+    unsigned long disk_write_count;
+    unsigned long disk_eviction_count;
+    // Bytes of the files in the cache directory:
+    std::size_t disk_footprint;
+
+    void write(std::ostream &out) const
+    {
+        out << "Hits: " << hit_count << std::endl <<
+            "Misses: " << miss_count << std::endl <<
+            "Evictions: " << eviction_count << std::endl <<
+            "Entries: " << entry_count << std::endl <<
+            "Memory footprint: " << memory_footprint << std::endl <<
+            "Disk hits: " << disk_hit_count << std::endl <<
+            "Disk writes: " << disk_write_count << std::endl <<
+            "Disk evictions: " << disk_eviction_count << std::endl <<
+            "Disk footprint: " << disk_footprint << std::endl;
+    }
+};
+
+// A memo of evaluated solids keyed by the structural hash of their
+// construction.
+//     Cached solids are shared, and immutable.  The least recently used
+// solids are evicted when the estimated memory footprint exceeds the
+// capacity.  The cache is disabled while its capacity is 0, which is the
+// default.
+//     Solids with persistent keys can also be stored in a directory, so
+// later processes load them instead of computing them again.  The files hold
+// CGAL's exact Nef polyhedron format, so loaded solids equal computed ones.
+// The least recently used files are deleted when their total size exceeds
+// the directory's capacity.
+class SolidCache
+{
+public:
+    typedef std::shared_ptr<const Nef_polyhedron_3> SolidPtr;
+
+private:
+    struct Entry
+    {
+        SolidPtr solid;
+        std::size_t memory_footprint;
+        std::list<StructuralHash>::iterator lru_position;
+    };
+
+    typedef std::unordered_map<StructuralHash, Entry, StructuralHash::Hasher>
+        Entries;
+
+    mutable std::mutex mutex;
+    Entries entries;
+    // Hashes from the most to the least recently used:
+    std::list<StructuralHash> lru_order;
+    std::size_t capacity;
+    SolidCacheStatistics statistics;
+
+    struct FileEntry
+    {
+        std::size_t size;
+        std::time_t access_time;
+    };
+
+    typedef std::unordered_map<
+        StructuralHash, FileEntry, StructuralHash::Hasher> Files;
+
+    // An empty directory disables persistence:
+    std::string directory;
+    std::size_t directory_capacity;
+    Files files;
+
+public:
+    // Bump when the solids built from the same recipe change, so that
+    // files written by older versions are ignored.  v2: shared circle
+    // tables, and building primitives through a surface mesh changed the
+    // tessalations' vertex coordinates, and order.
+    static const char *file_suffix()
+    {
+        return ".v2.nef3";
+    }
+
+    SolidCache(std::size_t capacity = 0)
+    : capacity(capacity),
+        directory_capacity(0)
+    {
+        reset_statistics();
+    }
+
+    SolidCache(const SolidCache &) = delete;
+    SolidCache &operator=(const SolidCache &) = delete;
+
+    // The cache consulted by Lazy_nef_polyhedron_3::evaluate().
+    static SolidCache &shared()
+    {
+        static SolidCache res;
+
+        return res;
+    }
+
+    // Sets the capacity in bytes of estimated memory footprint.
+    void set_capacity(std::size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        this->capacity = capacity;
+        evict();
+    }
+
+    // Stores solids with persistent keys in an existing directory, in up
+    // to the given number of bytes.  An empty path stops storing them.
+    //     Several processes can share the directory.
+    void set_directory(const std::string &path, std::size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        directory = path;
+        directory_capacity = capacity;
+        files.clear();
+        statistics.disk_footprint = 0;
+
+        if (!directory.empty())
+        {
+            scan_directory();
+            evict_files();
+        }
+    }
+
+    inline bool is_enabled() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return capacity > 0 || !directory.empty();
+    }
+
+    // Returns the cached solid with the given hash, or null.  Both halves
+    // of the hash must match.  Persistent
+    // keys are also looked up in the cache directory.
+    SolidPtr find(StructuralHash hash, bool is_persistent = false)
+    {
+        std::string path;
+
+        hash = configured_hash(hash);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (!is_enabled_locked())
+            {
+                return SolidPtr();
+            }
+
+            Entries::iterator found = entries.find(hash);
+
+            if (found != entries.end())
+            {
+                ++statistics.hit_count;
+                lru_order.splice(lru_order.begin(), lru_order,
+                    found->second.lru_position);
+
+                return found->second.solid;
+            }
+
+            // Look for the file even if it isn't indexed, since other
+            // processes may have written it:
+            if (!is_persistent || directory.empty())
+            {
+                ++statistics.miss_count;
+
+                return SolidPtr();
+            }
+
+            path = file_path(file_key(hash));
+        }
+
+        // Read outside the lock, so other threads can use the cache:
+        Nef_polyhedron_3 solid;
+        bool is_read = read_solid(path, solid);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (!is_read)
+            {
+                ++statistics.miss_count;
+                forget_file(file_key(hash));
+                // Let a damaged file be written again:
+                std::remove(path.c_str());
+
+                return SolidPtr();
+            }
+
+            ++statistics.disk_hit_count;
+            touch_file(file_key(hash), path);
+        }
+
+        return insert_in_memory(hash, solid);
+    }
+
+    // Caches a solid, and returns the shared copy.  Solids with persistent
+    // keys are also written to the cache directory.
+    SolidPtr insert(
+        StructuralHash hash, const Nef_polyhedron_3 &solid,
+        bool is_persistent = false)
+    {
+        hash = configured_hash(hash);
+
+        SolidPtr res = insert_in_memory(hash, solid);
+
+        if (!is_persistent)
+        {
+            return res;
+        }
+
+        StructuralHash key = file_key(hash);
+        std::string path;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            if (directory.empty() || files.count(key) > 0)
+            {
+                return res;
+            }
+
+            path = file_path(key);
+        }
+
+        std::size_t size;
+
+        if (!write_solid(path, *res, size))
+        {
+            return res;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // The directory may have changed while writing:
+        if (path == file_path(key) && files.count(key) == 0)
+        {
+            FileEntry &entry = files[key];
+
+            entry.size = size;
+            entry.access_time = std::time(nullptr);
+            ++statistics.disk_write_count;
+            statistics.disk_footprint += size;
+            evict_files();
+        }
+
+        return res;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        entries.clear();
+        lru_order.clear();
+        statistics.entry_count = 0;
+        statistics.memory_footprint = 0;
+    }
+
+    SolidCacheStatistics get_statistics() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return statistics;
+    }
+
+    void reset_statistics()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        statistics.hit_count = 0;
+        statistics.miss_count = 0;
+        statistics.eviction_count = 0;
+        statistics.entry_count = entries.size();
+        statistics.memory_footprint = 0;
+        for (const std::pair<const StructuralHash, Entry> &entry : entries)
+        {
+            statistics.memory_footprint += entry.second.memory_footprint;
+        }
+        statistics.disk_hit_count = 0;
+        statistics.disk_write_count = 0;
+        statistics.disk_eviction_count = 0;
+        statistics.disk_footprint = 0;
+        for (const std::pair<const StructuralHash, FileEntry> &file : files)
+        {
+            statistics.disk_footprint += file.second.size;
+        }
+    }
+
+private:
+    inline bool is_enabled_locked() const
+    {
+        return capacity > 0 || !directory.empty();
+    }
+
+    SolidPtr insert_in_memory(StructuralHash hash, const Nef_polyhedron_3 &solid)
+    {
+        std::shared_ptr<Nef_polyhedron_3> copy =
+            std::make_shared<Nef_polyhedron_3>(solid);
+
+        // Cached solids are read by several threads at once:
+        copy->apply_pending_transformation();
+
+        SolidPtr res = copy;
+        std::size_t memory_footprint = solid.estimated_memory_footprint();
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (capacity == 0 || entries.count(hash) > 0)
+        {
+            return res;
+        }
+
+        lru_order.push_front(hash);
+
+        Entry &entry = entries[hash];
+
+        entry.solid = res;
+        entry.memory_footprint = memory_footprint;
+        entry.lru_position = lru_order.begin();
+
+        ++statistics.entry_count;
+        statistics.memory_footprint += memory_footprint;
+        evict();
+
+        return res;
+    }
+
+    // Distinguishes solids rounded to the default snap grid, or whose
+    // boolean results were simplified, from others.
+    static StructuralHash configured_hash(StructuralHash hash)
+    {
+        const Kernel::FT &grid = Nef_polyhedron_3::default_snap_grid();
+
+        if (grid != 0)
+        {
+            hash = StructuralKey("snapped").add(grid).add(hash).hash();
+        }
+
+        if (Nef_polyhedron_3::simplify_results())
+        {
+            hash = StructuralKey("simplified").add(hash).hash();
+        }
+
+        return hash;
+    }
+
+    // Returns the key of a solid's file.  Solids built with different
+    // kernels are stored in different files.
+    static StructuralHash file_key(StructuralHash hash)
+    {
+        return StructuralKey("file").add(kernel_name()).add(hash).hash();
+    }
+
+    // Returns the path of the file with a key: both halves of the key, in
+    // 32 hexadecimal digits.  The caller must hold the mutex.
+    std::string file_path(StructuralHash key) const
+    {
+        std::ostringstream res;
+
+        res << directory << '/' << std::hex << std::setfill('0') <<
+            std::setw(16) << key.index << std::setw(16) << key.check <<
+            file_suffix();
+
+        return res.str();
+    }
+
+    static bool read_solid(const std::string &path, Nef_polyhedron_3 &res)
+    {
+        std::ifstream in(path, std::ios::binary);
+
+        if (!in)
+        {
+            return false;
+        }
+
+        try
+        {
+            in >> res;
+        }
+        catch (const std::exception &)
+        {
+            // A truncated, or otherwise damaged file:
+            return false;
+        }
+
+        return !in.fail();
+    }
+
+    // Writes a solid through a temporary file, so that readers in other
+    // processes never see a partial file.
+    static bool write_solid(
+        const std::string &path, const Nef_polyhedron_3 &solid,
+        std::size_t &size)
+    {
+        static std::atomic<unsigned long> temporary_id(0);
+
+        std::ostringstream temporary_path;
+
+        temporary_path << path << '.' << getpid() << '.' << temporary_id++ <<
+            ".tmp";
+
+        std::ofstream out(temporary_path.str(), std::ios::binary);
+
+        out << solid;
+        out.close();
+
+        struct stat file_status;
+
+        if (out.fail() ||
+            stat(temporary_path.str().c_str(), &file_status) != 0 ||
+            std::rename(temporary_path.str().c_str(), path.c_str()) != 0)
+        {
+            std::remove(temporary_path.str().c_str());
+
+            return false;
+        }
+
+        size = file_status.st_size;
+
+        return true;
+    }
+
+    // Indexes the solid files in the directory.  The caller must hold the
+    // mutex.
+    void scan_directory()
+    {
+        DIR *dir = opendir(directory.c_str());
+
+        if (dir == nullptr)
+        {
+            return;
+        }
+
+        const std::string suffix(file_suffix());
+
+        while (dirent *item = readdir(dir))
+        {
+            std::string name(item->d_name);
+
+            if (name.size() != 32 + suffix.size() ||
+                name.compare(32, suffix.size(), suffix) != 0 ||
+                name.find_first_not_of("0123456789abcdef") < 32)
+            {
+                continue;
+            }
+
+            struct stat file_status;
+
+            if (stat((directory + '/' + name).c_str(), &file_status) != 0)
+            {
+                continue;
+            }
+
+            StructuralHash key = {
+                std::stoull(name.substr(0, 16), nullptr, 16),
+                std::stoull(name.substr(16, 16), nullptr, 16)
+            };
+            FileEntry &entry = files[key];
+
+            entry.size = file_status.st_size;
+            entry.access_time = file_status.st_mtime;
+            statistics.disk_footprint += entry.size;
+        }
+
+        closedir(dir);
+    }
+
+    // Marks a file as recently used, also for other processes.  The caller
+    // must hold the mutex.
+    void touch_file(StructuralHash key, const std::string &path)
+    {
+        Files::iterator file = files.find(key);
+
+        utime(path.c_str(), nullptr);
+
+        if (file != files.end())
+        {
+            file->second.access_time = std::time(nullptr);
+
+            return;
+        }
+
+        struct stat file_status;
+
+        if (stat(path.c_str(), &file_status) == 0)
+        {
+            FileEntry &entry = files[key];
+
+            entry.size = file_status.st_size;
+            entry.access_time = file_status.st_mtime;
+            statistics.disk_footprint += entry.size;
+        }
+    }
+
+    // The caller must hold the mutex.
+    void forget_file(StructuralHash key)
+    {
+        Files::iterator file = files.find(key);
+
+        if (file != files.end())
+        {
+            statistics.disk_footprint -= file->second.size;
+            files.erase(file);
+        }
+    }
+
+    // Deletes the least recently used files, until their size fits the
+    // directory's capacity.  The caller must hold the mutex.
+    void evict_files()
+    {
+        if (statistics.disk_footprint <= directory_capacity)
+        {
+            return;
+        }
+
+        std::vector<std::pair<std::time_t, StructuralHash>> lru_files;
+
+        for (const std::pair<const StructuralHash, FileEntry> &file : files)
+        {
+            lru_files.push_back(
+                std::make_pair(file.second.access_time, file.first));
+        }
+        std::sort(lru_files.begin(), lru_files.end());
+
+        for (const std::pair<std::time_t, StructuralHash> &file : lru_files)
+        {
+            if (statistics.disk_footprint <= directory_capacity)
+            {
+                break;
+            }
+
+            // Another process may have deleted the file already:
+            std::remove(file_path(file.second).c_str());
+            ++statistics.disk_eviction_count;
+            forget_file(file.second);
+        }
+    }
+
+    // Evicts the least recently used entries, until the footprint fits the
+    // capacity.  The caller must hold the mutex.
+    void evict()
+    {
+        while (!lru_order.empty() && statistics.memory_footprint > capacity)
+        {
+            Entries::iterator entry = entries.find(lru_order.back());
+
+            statistics.memory_footprint -= entry->second.memory_footprint;
+            --statistics.entry_count;
+            ++statistics.eviction_count;
+            entries.erase(entry);
+            lru_order.pop_back();
+        }
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_SOLID_CACHE_H
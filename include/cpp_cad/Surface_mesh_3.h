@@ -0,0 +1,315 @@
+#ifndef _CPP_CAD_SURFACE_MESH_3_H
+#define _CPP_CAD_SURFACE_MESH_3_H
+
+#include <fstream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <CGAL/Surface_mesh.h>
+
+#include "Aff_transformation_3.h"
+#include "IndexedMesh.h"
+#include "reference_frame.h"
+#include "Polygon_2.h"
+#include "TessalationTolerance.h"
+#include "Polyhedron_3/Cube_3_Builder.h"
+#include "Polyhedron_3/Cylinder_3_TessalationBuilder.h"
+#include "Polyhedron_3/Icosphere_3_TessalationBuilder.h"
+#include "Polyhedron_3/IndexedMeshBuilder.h"
+#include "Polyhedron_3/LinearExtrusionBuilder.h"
+#include "Polyhedron_3/PolygonExtrusionBuilder.h"
+#include "Polyhedron_3/Polyhedron_3.h"
+#include "Polyhedron_3/RotateExtrusionTrack.h"
+#include "Polyhedron_3/Sphere_3_TessalationBuilder.h"
+#include "Polyhedron_3/SurfaceMeshSink.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+    // An index-based surface mesh, with the primitives of `Polyhedron_3`.
+    //     Vertices, halfedges, and faces are stored in contiguous arrays, so
+    // large tessalations take much less memory than in a `Polyhedron_3`, and
+    // are faster to traverse, export, and convert to a `Nef_polyhedron_3`.
+    class Surface_mesh_3 : public SurfaceMeshSink::Mesh
+    {
+        public:
+
+        typedef SurfaceMeshSink::Mesh Mesh;
+
+        Surface_mesh_3()
+        {}
+
+        Surface_mesh_3(const Mesh &source)
+        : Mesh(source)
+        {}
+
+        void add_cube(Coordinate x_length, Coordinate y_length, Coordinate z_length)
+        {
+            add<Cube_3_Builder<Mesh, SurfaceMeshSink>>(
+                nullptr, x_length, y_length, z_length);
+        }
+
+        void add_cube(
+            Coordinate x_length, Coordinate y_length, Coordinate z_length,
+            const Aff_transformation_3 &placement)
+        {
+            add<Cube_3_Builder<Mesh, SurfaceMeshSink>>(
+                &placement, x_length, y_length, z_length);
+        }
+
+        void add_cylindrical_tessalation(
+            Coordinate base_r = 1, Coordinate top_r = 1, Coordinate height = 1,
+            int linear_subdivision_c = 2)
+        {
+            add<CylinderBuilder>(
+                nullptr, base_r, top_r, height, linear_subdivision_c);
+        }
+
+        void add_cylindrical_tessalation(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            int linear_subdivision_c, const Aff_transformation_3 &placement)
+        {
+            add<CylinderBuilder>(
+                &placement, base_r, top_r, height, linear_subdivision_c);
+        }
+
+        void add_cylindrical_tessalation(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            const TessalationTolerance &tolerance)
+        {
+            add<CylinderBuilder>(nullptr, base_r, top_r, height, 0, tolerance);
+        }
+
+        void add_cylindrical_tessalation(
+            Coordinate base_r, Coordinate top_r, Coordinate height,
+            const TessalationTolerance &tolerance,
+            const Aff_transformation_3 &placement)
+        {
+            add<CylinderBuilder>(
+                &placement, base_r, top_r, height, 0, tolerance);
+        }
+
+        void add_spherical_tessalation(
+            Coordinate circumsphere_r = 1, int linear_subdivision_c = 2,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            add_sphere(tessalation, nullptr, circumsphere_r, linear_subdivision_c);
+        }
+
+        void add_spherical_tessalation(
+            Coordinate circumsphere_r, int linear_subdivision_c,
+            const Aff_transformation_3 &placement,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            add_sphere(
+                tessalation, &placement, circumsphere_r, linear_subdivision_c);
+        }
+
+        void add_spherical_tessalation(
+            Coordinate circumsphere_r, const TessalationTolerance &tolerance,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            add_sphere(tessalation, nullptr, circumsphere_r, 0, tolerance);
+        }
+
+        void add_spherical_tessalation(
+            Coordinate circumsphere_r, const TessalationTolerance &tolerance,
+            const Aff_transformation_3 &placement,
+            SphereTessalation tessalation =
+                SphereTessalation::LATITUDE_LONGITUDE)
+        {
+            add_sphere(tessalation, &placement, circumsphere_r, 0, tolerance);
+        }
+
+        void add_linear_extrusion(const Polygon_2 &polygon, Kernel::FT height)
+        {
+            add<LinearExtrusionBuilder<Mesh, SurfaceMeshSink>>(
+                nullptr, polygon, height);
+        }
+
+        void add_linear_extrusion(
+            const Polygon_2 &polygon, Kernel::FT height,
+            const Aff_transformation_3 &placement)
+        {
+            add<LinearExtrusionBuilder<Mesh, SurfaceMeshSink>>(
+                &placement, polygon, height);
+        }
+
+        void add_rotate_extrusion(
+            const Polygon_2 &polygon, double angle = 2 * M_PI,
+            int subdivision_c = 16, double eps = 1e-15)
+        {
+            add_rotate_extrusion(polygon, angle, subdivision_c, nullptr, eps);
+        }
+
+        void add_rotate_extrusion(
+            const Polygon_2 &polygon, double angle, int subdivision_c,
+            const Aff_transformation_3 &placement, double eps = 1e-15)
+        {
+            add_rotate_extrusion(polygon, angle, subdivision_c, &placement, eps);
+        }
+
+        void add_rotate_extrusion(
+            const Polygon_2 &polygon, double angle,
+            const TessalationTolerance &tolerance, double eps = 1e-15)
+        {
+            add_rotate_extrusion(polygon, angle,
+                Polyhedron_3::rotate_extrusion_subdivision_count(
+                    polygon, angle, tolerance, eps),
+                nullptr, eps);
+        }
+
+        void add_rotate_extrusion(
+            const Polygon_2 &polygon, double angle,
+            const TessalationTolerance &tolerance,
+            const Aff_transformation_3 &placement, double eps = 1e-15)
+        {
+            add_rotate_extrusion(polygon, angle,
+                Polyhedron_3::rotate_extrusion_subdivision_count(
+                    polygon, angle, tolerance, eps),
+                &placement, eps);
+        }
+
+        // Adds the vertices, and faces of a mesh in flat arrays, in one
+        // pass, with storage reserved for all of them.
+        void add_indexed_mesh(const IndexedMesh &mesh)
+        {
+            add<IndexedMeshBuilder<Mesh, SurfaceMeshSink>>(nullptr, mesh);
+        }
+
+        void add_indexed_mesh(
+            const IndexedMesh &mesh, const Aff_transformation_3 &placement)
+        {
+            add<IndexedMeshBuilder<Mesh, SurfaceMeshSink>>(&placement, mesh);
+        }
+
+        template<typename PolygonInputIterator>
+        void add_polygon_extrusion(
+            PolygonInputIterator track_start,
+            const PolygonInputIterator &track_end, bool closed = false)
+        {
+            add<PolygonExtrusionBuilder<
+                Mesh, PolygonInputIterator, SurfaceMeshSink>>(
+                    nullptr, track_start, track_end, closed);
+        }
+
+        template<typename PolygonInputIterator>
+        void add_polygon_extrusion(
+            PolygonInputIterator track_start,
+            const PolygonInputIterator &track_end, bool closed,
+            const Aff_transformation_3 &placement)
+        {
+            add<PolygonExtrusionBuilder<
+                Mesh, PolygonInputIterator, SurfaceMeshSink>>(
+                    &placement, track_start, track_end, closed);
+        }
+
+        // Adds a primitive with a builder, whose halfedge data structure is
+        // a surface mesh, and whose sink is a `SurfaceMeshSink`.  `args`
+        // follow the builder's halfedge data structure argument.
+        // `placement` may be null.  Throws `std::invalid_argument`, if the
+        // primitive's faces don't form a manifold surface.  The faces,
+        // which did, stay in the mesh.
+        template <class Builder, class... Args>
+        void add(const Aff_transformation_3 *placement, Args &&... args)
+        {
+            Builder builder(*this, std::forward<Args>(args)...);
+
+            if (placement != nullptr)
+            {
+                builder.set_placement(*placement);
+            }
+
+            builder.run();
+
+            if (builder.error())
+            {
+                throw std::invalid_argument(
+                    "The faces of the primitive don't form a manifold "
+                    "surface.");
+            }
+        }
+
+        // Writes the mesh in Wavefront OBJ format.  Removed elements must
+        // have been collected with `collect_garbage()`.
+        void write_obj(std::ostream &out) const
+        {
+            for (Vertex_index v : vertices())
+            {
+                const Point_3 &p = point(v);
+
+                out << "v " << CGAL::to_double(p.x()) << ' ' <<
+                    CGAL::to_double(p.y()) << ' ' <<
+                    CGAL::to_double(p.z()) << '\n';
+            }
+
+            for (Face_index f : faces())
+            {
+                out << 'f';
+
+                for (Vertex_index v :
+                    vertices_around_face(halfedge(f)))
+                {
+                    // OBJ vertex numbers start from 1:
+                    out << ' ' << static_cast<size_type>(v) + 1;
+                }
+
+                out << '\n';
+            }
+        }
+
+        void write_to_obj_file(std::string path) const
+        {
+            std::ofstream output_f(path);
+
+            write_obj(output_f);
+        }
+
+        private:
+
+        typedef Cylinder_3_TessalationBuilder<Mesh, SurfaceMeshSink>
+            CylinderBuilder;
+
+        template <class... Args>
+        void add_sphere(
+            SphereTessalation tessalation,
+            const Aff_transformation_3 *placement, const Args &... args)
+        {
+            if (tessalation == SphereTessalation::GEODESIC)
+            {
+                add<Icosphere_3_TessalationBuilder<Mesh, SurfaceMeshSink>>(
+                    placement, args...);
+            }
+            else
+            {
+                add<Sphere_3_TessalationBuilder<Mesh, SurfaceMeshSink>>(
+                    placement, args...);
+            }
+        }
+
+        // `placement` may be null.
+        void add_rotate_extrusion(
+            const Polygon_2 &polygon, double angle, int subdivision_c,
+            const Aff_transformation_3 *placement, double eps)
+        {
+            RotateExtrusionTrack track(polygon, angle, subdivision_c, eps);
+            RotateExtrusionTrack::Iterator track_begin = track.begin();
+            RotateExtrusionTrack::Iterator track_end = track.end();
+
+            add<PolygonExtrusionBuilder<
+                Mesh, RotateExtrusionTrack::Iterator, SurfaceMeshSink>>(
+                    placement, track_begin, track_end, track.is_closed());
+        }
+    };
+}
+}
+
+
+#endif // _CPP_CAD_SURFACE_MESH_3_H
@@ -0,0 +1,133 @@
+#ifndef _CPP_CAD_TESSALATION_CACHE_H
+#define _CPP_CAD_TESSALATION_CACHE_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+#include <CGAL/Nef_polyhedron_3.h>
+
+#include "reference_frame.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// Counts the solids served from, and added to a TessalationCache.
+struct TessalationCacheStatistics
+{
+    std::atomic<unsigned long> hit_count;
+    std::atomic<unsigned long> miss_count;
+
+    TessalationCacheStatistics()
+    : hit_count(0),
+        miss_count(0)
+    {}
+
+    void reset()
+    {
+        hit_count = 0;
+        miss_count = 0;
+    }
+
+    void write(std::ostream &out) const
+    {
+        out << "Hits: " << hit_count << std::endl <<
+            "Misses: " << miss_count << std::endl;
+    }
+};
+
+// Keeps prebuilt, immutable tessalations of primitives, keyed by the
+// primitive, and the parameters that its shape depends on.
+//     The factories of `Nef_polyhedron_3` store unit primitives here, and
+// scale copies of them, instead of building, and converting the same
+// tessalation again.  Copies of a Nef polyhedron share its SNC, until
+// either is changed, so the cached solids are never modified.
+class TessalationCache
+{
+public:
+    typedef CGAL::Nef_polyhedron_3<Kernel> Solid;
+    typedef std::shared_ptr<const Solid> SolidPtr;
+
+private:
+    std::mutex mutex;
+    std::map<std::string, SolidPtr> solids;
+    TessalationCacheStatistics statistics;
+
+public:
+    TessalationCache()
+    {}
+
+    TessalationCache(const TessalationCache &) = delete;
+    TessalationCache &operator=(const TessalationCache &) = delete;
+
+    static TessalationCache &shared()
+    {
+        static TessalationCache res;
+
+        return res;
+    }
+
+    inline const TessalationCacheStatistics &get_statistics() const
+    {
+        return statistics;
+    }
+
+    void reset_statistics()
+    {
+        statistics.reset();
+    }
+
+    // Returns the solid with the key, and calls `build()` to make it, if it
+    // isn't cached.
+    //     Solids are built outside the lock, so different primitives are
+    // built concurrently.  Two threads may build the same solid, but only
+    // the first one is kept.
+    template <class Build>
+    SolidPtr get(const std::string &key, Build build)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::map<std::string, SolidPtr>::const_iterator it =
+                solids.find(key);
+
+            if (it != solids.end())
+            {
+                ++statistics.hit_count;
+
+                return it->second;
+            }
+        }
+
+        ++statistics.miss_count;
+
+        SolidPtr res = std::make_shared<const Solid>(build());
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return solids.insert(std::make_pair(key, res)).first->second;
+    }
+
+    inline std::size_t size()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        return solids.size();
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        solids.clear();
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_TESSALATION_CACHE_H
@@ -0,0 +1,83 @@
+#ifndef _CPP_CAD_TESSALATION_TOLERANCE_H
+#define _CPP_CAD_TESSALATION_TOLERANCE_H
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace cpp_cad
+{
+
+// Bounds how far a tessalation of a curved surface may be from the
+// surface.  Tessalations built with a tolerance get the fewest subdivisions
+// that meet it, computed from the actual radius of each circle.
+//     A bound of 0 isn't checked.
+struct TessalationTolerance
+{
+    // The largest distance between an arc, and its chord:
+    double max_chord_deviation;
+    // The largest angle an arc's chord may span, in radians:
+    double max_angle;
+
+    explicit TessalationTolerance(
+        double max_chord_deviation = 0, double max_angle = 0)
+    : max_chord_deviation(max_chord_deviation),
+        max_angle(max_angle)
+    {}
+
+    static TessalationTolerance chord_deviation(double max_chord_deviation)
+    {
+        return TessalationTolerance(max_chord_deviation, 0);
+    }
+
+    static TessalationTolerance angle(double max_angle)
+    {
+        return TessalationTolerance(0, max_angle);
+    }
+
+    inline bool is_set() const
+    {
+        return max_chord_deviation > 0 || max_angle > 0;
+    }
+
+    // Returns the largest angle, which a chord of a circle with radius `r`
+    // may span.
+    double max_step_angle(double r) const
+    {
+        double res = 2 * M_PI;
+
+        if (max_angle > 0)
+        {
+            res = std::min(res, max_angle);
+        }
+        if (max_chord_deviation > 0 && max_chord_deviation < r)
+        {
+            // The deviation is r * (1 - cos(step / 2)):
+            res = std::min(res, 2 * acos(1 - max_chord_deviation / r));
+        }
+
+        return res;
+    }
+
+    // Returns the number of chords, which an arc with radius `r`, spanning
+    // `angle` radians needs.
+    int arc_subdivision_count(double r, double angle) const
+    {
+        // Don't add a subdivision for rounding errors:
+        const double eps = 1e-9;
+
+        return std::max(1, static_cast<int>(
+            ceil(std::abs(angle) / max_step_angle(std::abs(r)) - eps)));
+    }
+
+    // Returns the number of chords, which a circle with radius `r` needs.
+    // Circles get, at least, 3.
+    int circle_subdivision_count(double r) const
+    {
+        return std::max(3, arc_subdivision_count(r, 2 * M_PI));
+    }
+};
+
+}
+
+#endif // _CPP_CAD_TESSALATION_TOLERANCE_H
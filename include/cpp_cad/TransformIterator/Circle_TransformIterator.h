@@ -6,6 +6,8 @@
 
 
 namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
 {
     template <Aff_transformation_3 TransformFunctor(double angle, double r)>
     class CircleTransformIterator
@@ -98,5 +100,6 @@ namespace cpp_cad
     typedef CircleTransformIterator<Aff_transformation_3::rotate_y>   YCircleTransformIterator;
     typedef CircleTransformIterator<Aff_transformation_3::rotate_z>   ZCircleTransformIterator;
 }
+}
 
 #endif // _CPP_CAD_CIRCLE_TRANSFORM_ITERATOR_H
@@ -6,6 +6,8 @@
 
 
 namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
 {
     template <Aff_transformation_3 TransformFunctor(double angle)>
     class RotateTransformIterator
@@ -95,5 +97,6 @@ namespace cpp_cad
     typedef RotateTransformIterator<Aff_transformation_3::rotate_y>   YRotateTransformIterator;
     typedef RotateTransformIterator<Aff_transformation_3::rotate_z>   ZRotateTransformIterator;
 }
+}
 
 #endif // _CPP_CAD_ROTATE_TRANSFORM_ITERATOR_H
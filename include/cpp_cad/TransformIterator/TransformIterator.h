@@ -6,6 +6,8 @@
 
 
 namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
 {
     class TransformIterator
     {
@@ -92,5 +94,6 @@ namespace cpp_cad
         typedef Rotation<Aff_transformation_3::rotate_z> ZRotation;
     };
 }
+}
 
 #endif // _CPP_CAD_TRANSFORM_ITERATOR_H
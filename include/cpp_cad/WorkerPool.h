@@ -0,0 +1,431 @@
+#ifndef _CPP_CAD_WORKER_POOL_H
+#define _CPP_CAD_WORKER_POOL_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace cpp_cad
+{
+
+// A fixed set of worker threads that run submitted tasks.
+//     Each worker has its own task deque.  A worker runs the tasks it
+// submitted itself last in, first out, so nested tasks run while their
+// operands are still hot, and steals the oldest tasks of other workers when
+// its deque is empty.  Tasks submitted from other threads are dealt to the
+// workers in turn.
+//     Waiting for a result with `Future::get()` runs queued tasks in the
+// meantime, so tasks can submit, and wait for, subtasks without
+// exhausting the workers.  A task only runs the awaited task, its subtasks,
+// and its own subtasks while it waits, since an unrelated task could wait
+// for the waiting one, lower on the same stack.  Task results don't depend on which thread runs
+// them, or in which order, so results are the same for any worker count.
+//     CGAL geometry objects are reference counted, so tasks that share
+// operands require a CGAL configured with thread support (CGAL_HAS_THREADS).
+class WorkerPool
+{
+public:
+    // A handle to the result of a submitted task.  Copies share the result.
+    template <class Result>
+    class Future
+    {
+    private:
+        std::shared_future<Result> future;
+        WorkerPool *pool;
+        // The id of the task that computes the result, or 0:
+        std::uint64_t task_id;
+
+    public:
+        Future()
+        : pool(nullptr),
+            task_id(0)
+        {}
+
+        Future(
+            std::shared_future<Result> future, WorkerPool &pool,
+            std::uint64_t task_id = 0)
+        : future(future),
+            pool(&pool),
+            task_id(task_id)
+        {}
+
+        inline bool valid() const
+        {
+            return future.valid();
+        }
+
+        inline bool is_ready() const
+        {
+            return future.wait_for(std::chrono::seconds(0)) ==
+                std::future_status::ready;
+        }
+
+        // Runs queued tasks, that can't depend on the waiting task, until
+        // the result is ready.
+        void wait() const
+        {
+            while (!is_ready())
+            {
+                if (pool == nullptr || !pool->run_task_for(task_id))
+                {
+                    // The task is running on another thread:
+                    future.wait();
+                }
+            }
+        }
+
+        // Waits for the result, and returns it, or rethrows the task's
+        // exception.
+        auto get() const ->
+            decltype(std::declval<const std::shared_future<Result> &>().get())
+        {
+            wait();
+
+            return future.get();
+        }
+    };
+
+    // Waits for all futures of a vector, when the scope it's declared in is
+    // left.  Declare it after the vector of futures, whose tasks refer to
+    // locals of the scope, so the tasks finish before the locals are
+    // destroyed, even if the scope is left by an exception.
+    template <class Result>
+    class WaitGuard
+    {
+    private:
+        const std::vector<Future<Result>> &futures;
+
+    public:
+        explicit WaitGuard(const std::vector<Future<Result>> &futures)
+        : futures(futures)
+        {}
+
+        WaitGuard(const WaitGuard &) = delete;
+        WaitGuard &operator=(const WaitGuard &) = delete;
+
+        ~WaitGuard()
+        {
+            for (const Future<Result> &future : futures)
+            {
+                if (future.valid())
+                {
+                    future.wait();
+                }
+            }
+        }
+    };
+
+private:
+    struct Task
+    {
+        std::function<void()> run;
+        std::uint64_t id;
+        // The id of the task that submitted it, or 0, if it was submitted
+        // from outside of any task:
+        std::uint64_t parent;
+    };
+
+    struct TaskDeque
+    {
+        std::deque<Task> tasks;
+        std::mutex mutex;
+    };
+
+    std::vector<std::unique_ptr<TaskDeque>> task_deques;
+    std::vector<std::thread> workers;
+    // The number of queued tasks:
+    std::atomic<std::size_t> pending_count;
+    // The next deque for tasks submitted from other threads:
+    std::atomic<std::size_t> next_deque;
+    std::atomic<std::uint64_t> next_task_id;
+    // Idle workers sleep on `tasks_available`:
+    std::mutex idle_mutex;
+    std::condition_variable tasks_available;
+    bool stopping;
+
+public:
+    // Starts `worker_count` worker threads, or one thread per hardware
+    // thread, if `worker_count` is 0.
+    explicit WorkerPool(unsigned worker_count = 0)
+    : pending_count(0),
+        next_deque(0),
+        next_task_id(1),
+        stopping(false)
+    {
+        if (worker_count == 0)
+        {
+            worker_count = default_worker_count();
+        }
+
+        task_deques.reserve(worker_count);
+        for (unsigned c = 0; c < worker_count; ++c)
+        {
+            task_deques.emplace_back(new TaskDeque());
+        }
+
+        workers.reserve(worker_count);
+        for (unsigned c = 0; c < worker_count; ++c)
+        {
+            workers.emplace_back(&WorkerPool::run_worker, this, c);
+        }
+    }
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    // Runs the remaining queued tasks, and joins the worker threads.
+    ~WorkerPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(idle_mutex);
+
+            stopping = true;
+        }
+        tasks_available.notify_all();
+
+        for (auto &worker : workers)
+        {
+            worker.join();
+        }
+    }
+
+    static unsigned default_worker_count()
+    {
+        unsigned res = std::thread::hardware_concurrency();
+
+        return res > 0 ? res : 1;
+    }
+
+    // The worker count of the shared pool, or 0 for one worker per hardware
+    // thread.  It must be set before the shared pool is first used.
+    static unsigned &shared_worker_count()
+    {
+        static unsigned res = 0;
+
+        return res;
+    }
+
+    // The pool used by the library's parallel operations by default.
+    static WorkerPool &shared()
+    {
+        static WorkerPool res(shared_worker_count());
+
+        return res;
+    }
+
+    inline unsigned size() const
+    {
+        return workers.size();
+    }
+
+    // Queues a task, and returns a future for its result.
+    template <class Function>
+    Future<typename std::result_of<Function()>::type> submit(
+        Function function)
+    {
+        typedef typename std::result_of<Function()>::type Result;
+
+        // std::function needs a copyable target, so share the packaged task:
+        std::shared_ptr<std::packaged_task<Result()>> task =
+            std::make_shared<std::packaged_task<Result()>>(std::move(function));
+        std::uint64_t task_id = next_task_id++;
+        Future<Result> res(task->get_future().share(), *this, task_id);
+        std::size_t deque_index = current_pool() == this ?
+            current_worker() : next_deque++ % task_deques.size();
+        TaskDeque &task_deque = *task_deques[deque_index];
+
+        ++pending_count;
+        {
+            std::lock_guard<std::mutex> lock(task_deque.mutex);
+
+            Task entry;
+
+            entry.run = [task]() { (*task)(); };
+            entry.id = task_id;
+            entry.parent = current_task();
+            task_deque.tasks.push_back(std::move(entry));
+        }
+
+        {
+            // Keeps a worker from missing the notification between checking
+            // for tasks, and going to sleep:
+            std::lock_guard<std::mutex> lock(idle_mutex);
+        }
+        tasks_available.notify_one();
+
+        return res;
+    }
+
+    // Runs one queued task on the calling thread.  Returns false, if there
+    // are no queued tasks.
+    bool run_pending_task()
+    {
+        return run_task(0, false);
+    }
+
+private:
+    // Runs one queued task, that can't depend on the task running on the
+    // calling thread, while it waits for the task with `awaited_id`.
+    // Threads outside of any task may run any task.
+    bool run_task_for(std::uint64_t awaited_id)
+    {
+        return run_task(awaited_id, current_task() != 0);
+    }
+
+    bool run_task(std::uint64_t awaited_id, bool restricted)
+    {
+        Task task;
+        bool is_worker = current_pool() == this;
+
+        if (!take_task(is_worker ? current_worker() : 0, is_worker,
+            awaited_id, restricted, task))
+        {
+            return false;
+        }
+
+        run(task);
+
+        return true;
+    }
+
+    // Runs a task, with its id as the current task of the thread:
+    static void run(Task &task)
+    {
+        std::uint64_t outer_task = current_task();
+
+        current_task() = task.id;
+        task.run();
+        current_task() = outer_task;
+    }
+
+    // Tasks run while waiting for `awaited_id` must be the awaited task, or
+    // subtasks of it, or of the waiting task.  They can't wait for the
+    // waiting task, unless tasks wait for each other in a cycle.
+    static bool can_help(
+        const Task &task, std::uint64_t awaited_id, bool restricted)
+    {
+        return !restricted || task.id == awaited_id ||
+            task.parent == awaited_id || task.parent == current_task();
+    }
+    // The id of the task running on this thread, or 0:
+    static std::uint64_t &current_task()
+    {
+        static thread_local std::uint64_t res = 0;
+
+        return res;
+    }
+
+    // The pool, and the index of the worker running on this thread:
+    static WorkerPool *&current_pool()
+    {
+        static thread_local WorkerPool *res = nullptr;
+
+        return res;
+    }
+
+    static std::size_t &current_worker()
+    {
+        static thread_local std::size_t res = 0;
+
+        return res;
+    }
+
+    // Takes the newest task of the worker's own deque, or else the oldest
+    // task of another worker's deque.  Other threads only take the oldest
+    // tasks, starting from the deque with `worker_index`.  Waiting threads
+    // skip the tasks they can't help with.
+    bool take_task(
+        std::size_t worker_index, bool is_worker, std::uint64_t awaited_id,
+        bool restricted, Task &task)
+    {
+        if (pending_count == 0)
+        {
+            return false;
+        }
+
+        if (is_worker)
+        {
+            TaskDeque &own = *task_deques[worker_index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+
+            for (auto it = own.tasks.rbegin(); it != own.tasks.rend(); ++it)
+            {
+                if (can_help(*it, awaited_id, restricted))
+                {
+                    task = std::move(*it);
+                    own.tasks.erase(std::next(it).base());
+                    --pending_count;
+
+                    return true;
+                }
+            }
+        }
+
+        for (std::size_t c = is_worker ? 1 : 0; c < task_deques.size(); ++c)
+        {
+            TaskDeque &victim =
+                *task_deques[(worker_index + c) % task_deques.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+
+            for (auto it = victim.tasks.begin(); it != victim.tasks.end(); ++it)
+            {
+                if (can_help(*it, awaited_id, restricted))
+                {
+                    task = std::move(*it);
+                    victim.tasks.erase(it);
+                    --pending_count;
+
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void run_worker(std::size_t worker_index)
+    {
+        current_pool() = this;
+        current_worker() = worker_index;
+
+        while (true)
+        {
+            Task task;
+
+            if (take_task(worker_index, true, 0, false, task))
+            {
+                run(task);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(idle_mutex);
+
+            tasks_available.wait(lock, [this]()
+                {
+                    return stopping || pending_count > 0;
+                });
+
+            if (stopping && pending_count == 0)
+            {
+                return;
+            }
+        }
+    }
+};
+
+}
+
+#endif // _CPP_CAD_WORKER_POOL_H
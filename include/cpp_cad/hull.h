@@ -0,0 +1,232 @@
+#ifndef _CPP_CAD_HULL_H
+#define _CPP_CAD_HULL_H
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include "Aff_transformation_3.h"
+#include "Nef_polyhedron_3.h"
+#include "Polygon_2.h"
+#include "Polyhedron_3/Cube_3_Builder.h"
+#include "Polyhedron_3/Cylinder_3_TessalationBuilder.h"
+#include "Polyhedron_3/LinearExtrusionBuilder.h"
+#include "Polyhedron_3/PointCollector.h"
+#include "Polyhedron_3/PolygonExtrusionBuilder.h"
+#include "Polyhedron_3/Polyhedron_3.h"
+#include "Polyhedron_3/RotateExtrusionTrack.h"
+#include "Polyhedron_3/Sphere_3_TessalationBuilder.h"
+#include "reference_frame.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// The vertices of primitives, whose convex hull is taken by `hull()`.
+//     The primitives' builders stream their vertices straight into a point
+// list.  Their faces aren't built.
+class HullPoints
+{
+private:
+    // The builders write to a point list, instead of a halfedge data
+    // structure:
+    typedef std::vector<Point_3> HDS;
+
+    std::vector<Point_3> points;
+
+public:
+    inline const std::vector<Point_3> &get_points() const
+    {
+        return points;
+    }
+
+    inline HullPoints &add_point(const Point_3 &point)
+    {
+        points.push_back(point);
+
+        return *this;
+    }
+
+    inline HullPoints &add_cube(
+        Kernel::FT x_length, Kernel::FT y_length, Kernel::FT z_length)
+    {
+        return add_cube(x_length, y_length, z_length, nullptr);
+    }
+
+    inline HullPoints &add_cube(
+        Kernel::FT x_length, Kernel::FT y_length, Kernel::FT z_length,
+        const Aff_transformation_3 &placement)
+    {
+        return add_cube(x_length, y_length, z_length, &placement);
+    }
+
+    inline HullPoints &add_cylinder(
+        Kernel::FT base_r = 1, Kernel::FT top_r = 1, Kernel::FT height = 1,
+        int linear_subdivision_c = 2)
+    {
+        return add_cylinder(
+            base_r, top_r, height, linear_subdivision_c, nullptr);
+    }
+
+    inline HullPoints &add_cylinder(
+        Kernel::FT base_r, Kernel::FT top_r, Kernel::FT height,
+        int linear_subdivision_c, const Aff_transformation_3 &placement)
+    {
+        return add_cylinder(
+            base_r, top_r, height, linear_subdivision_c, &placement);
+    }
+
+    inline HullPoints &add_sphere(
+        Kernel::FT circumsphere_r = 1, int linear_subdivision_c = 2)
+    {
+        return add_sphere(circumsphere_r, linear_subdivision_c, nullptr);
+    }
+
+    inline HullPoints &add_sphere(
+        Kernel::FT circumsphere_r, int linear_subdivision_c,
+        const Aff_transformation_3 &placement)
+    {
+        return add_sphere(circumsphere_r, linear_subdivision_c, &placement);
+    }
+
+    inline HullPoints &add_linear_extrusion(
+        const Polygon_2 &polygon, Kernel::FT height)
+    {
+        return add_linear_extrusion(polygon, height, nullptr);
+    }
+
+    inline HullPoints &add_linear_extrusion(
+        const Polygon_2 &polygon, Kernel::FT height,
+        const Aff_transformation_3 &placement)
+    {
+        return add_linear_extrusion(polygon, height, &placement);
+    }
+
+    inline HullPoints &add_rotate_extrusion(
+        const Polygon_2 &polygon, double angle = 2 * M_PI,
+        int subdivision_c = 16, double eps = 1e-15)
+    {
+        return add_rotate_extrusion(
+            polygon, angle, subdivision_c, nullptr, eps);
+    }
+
+    inline HullPoints &add_rotate_extrusion(
+        const Polygon_2 &polygon, double angle, int subdivision_c,
+        const Aff_transformation_3 &placement, double eps = 1e-15)
+    {
+        return add_rotate_extrusion(
+            polygon, angle, subdivision_c, &placement, eps);
+    }
+
+private:
+    // `placement` may be null in the following functions.
+
+    template <class Builder>
+    inline HullPoints &run(
+        Builder &builder, const Aff_transformation_3 *placement)
+    {
+        if (placement != nullptr)
+        {
+            builder.set_placement(*placement);
+        }
+
+        builder.run();
+
+        return *this;
+    }
+
+    inline HullPoints &add_cube(
+        Kernel::FT x_length, Kernel::FT y_length, Kernel::FT z_length,
+        const Aff_transformation_3 *placement)
+    {
+        Cube_3_Builder<HDS, PointCollector> builder(
+            points, x_length, y_length, z_length);
+
+        return run(builder, placement);
+    }
+
+    inline HullPoints &add_cylinder(
+        Kernel::FT base_r, Kernel::FT top_r, Kernel::FT height,
+        int linear_subdivision_c, const Aff_transformation_3 *placement)
+    {
+        Cylinder_3_TessalationBuilder<HDS, PointCollector> builder(
+            points, base_r, top_r, height, linear_subdivision_c);
+
+        return run(builder, placement);
+    }
+
+    inline HullPoints &add_sphere(
+        Kernel::FT circumsphere_r, int linear_subdivision_c,
+        const Aff_transformation_3 *placement)
+    {
+        Sphere_3_TessalationBuilder<HDS, PointCollector> builder(
+            points, circumsphere_r, linear_subdivision_c);
+
+        return run(builder, placement);
+    }
+
+    inline HullPoints &add_linear_extrusion(
+        const Polygon_2 &polygon, Kernel::FT height,
+        const Aff_transformation_3 *placement)
+    {
+        LinearExtrusionBuilder<HDS, PointCollector> builder(
+            points, polygon, height);
+
+        return run(builder, placement);
+    }
+
+    // Follows `Polyhedron_3::add_rotate_extrusion()`.
+    inline HullPoints &add_rotate_extrusion(
+        const Polygon_2 &polygon, double angle, int subdivision_c,
+        const Aff_transformation_3 *placement, double eps)
+    {
+        RotateExtrusionTrack track(polygon, angle, subdivision_c, eps);
+        RotateExtrusionTrack::Iterator track_begin = track.begin();
+        RotateExtrusionTrack::Iterator track_end = track.end();
+
+        PolygonExtrusionBuilder<
+            HDS, RotateExtrusionTrack::Iterator, PointCollector> builder(
+                points, track_begin, track_end, track.is_closed());
+
+        return run(builder, placement);
+    }
+};
+
+// Returns the convex hull of the points as a mesh.  The mesh is degenerate
+// (not closed), if the points are coplanar.
+inline Polyhedron_3 hull_polyhedron(const HullPoints &points)
+{
+    Polyhedron_3 res;
+
+    // The graph traits, which the hull is built with, are only specialized
+    // for the CGAL class:
+    CGAL::convex_hull_3(
+        points.get_points().begin(), points.get_points().end(),
+        static_cast<CGAL::Polyhedron_3<Kernel> &>(res));
+
+    return res;
+}
+
+// Returns the convex hull of the points as a solid.  The solid is empty, if
+// the points are coplanar.
+inline Nef_polyhedron_3 hull(const HullPoints &points)
+{
+    Polyhedron_3 mesh = hull_polyhedron(points);
+
+    if (mesh.size_of_vertices() < 4 || !mesh.is_closed())
+    {
+        return Nef_polyhedron_3(Nef_polyhedron_3::EMPTY);
+    }
+
+    return Nef_polyhedron_3(mesh);
+}
+
+}
+}
+
+#endif // _CPP_CAD_HULL_H
@@ -0,0 +1,215 @@
+#ifndef _CPP_CAD_MESH_BOOLEAN_OPERATIONS_H
+#define _CPP_CAD_MESH_BOOLEAN_OPERATIONS_H
+
+#include <atomic>
+#include <ostream>
+#include <stdexcept>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/orientation.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+#include <CGAL/Polygon_mesh_processing/triangulate_faces.h>
+
+#include "Nef_polyhedron_3.h"
+#include "reference_frame.h"
+#include "Polyhedron_3/Polyhedron_3.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// Selects the algorithm that computes a boolean operation on two meshes.
+enum class BooleanBackend
+{
+    // Overlay of the meshes' Nef polyhedra.  Handles any closed input, but
+    // is slow, and uses a lot of memory.
+    NEF,
+    // Corefinement of closed, manifold triangle meshes that bound a volume.
+    // Closed meshes that intersect themselves, or don't bound a volume, and
+    // results that corefinement can't represent fall back to NEF.
+    COREFINEMENT
+};
+
+// Counts which backend computed the mesh boolean operations.
+struct MeshBooleanStatistics
+{
+    std::atomic<unsigned long> corefinement_count;
+    std::atomic<unsigned long> nef_count;
+    // Operations that requested COREFINEMENT, but ran on NEF:
+    std::atomic<unsigned long> nef_fallback_count;
+
+    MeshBooleanStatistics()
+    : corefinement_count(0),
+        nef_count(0),
+        nef_fallback_count(0)
+    {}
+
+    void reset()
+    {
+        corefinement_count = 0;
+        nef_count = 0;
+        nef_fallback_count = 0;
+    }
+
+    void write(std::ostream &out) const
+    {
+        out << "Corefinements: " << corefinement_count << std::endl <<
+            "Nef overlays: " << nef_count << std::endl <<
+            "Nef fallbacks: " << nef_fallback_count << std::endl;
+    }
+};
+
+inline MeshBooleanStatistics &mesh_boolean_statistics()
+{
+    static MeshBooleanStatistics res;
+
+    return res;
+}
+
+namespace internal
+{
+
+typedef CGAL::Polyhedron_3<Kernel> Corefinement_mesh;
+
+// Triangulates a copy of a closed mesh for corefinement.  Returns false, if
+// the mesh can't be corefined, because it intersects itself, or doesn't
+// bound a volume.
+inline bool prepare_corefinement_operand(
+    const Polyhedron_3 &polyhedron, Corefinement_mesh &res)
+{
+    namespace PMP = CGAL::Polygon_mesh_processing;
+
+    res = polyhedron;
+
+    if (!CGAL::is_triangle_mesh(res))
+    {
+        PMP::triangulate_faces(res);
+    }
+
+    return !PMP::does_self_intersect(res) && PMP::does_bound_a_volume(res);
+}
+
+template <class CorefinementOperation, class NefOperation>
+Polyhedron_3 mesh_boolean_operation(
+    const Polyhedron_3 &lhs, const Polyhedron_3 &rhs, BooleanBackend backend,
+    CorefinementOperation corefinement_operation, NefOperation nef_operation)
+{
+    // Neither backend handles open meshes:
+    if (!lhs.is_closed() || !rhs.is_closed())
+    {
+        throw std::invalid_argument(
+            "Mesh boolean operations require closed meshes.");
+    }
+
+    if (backend == BooleanBackend::COREFINEMENT)
+    {
+        Corefinement_mesh lhs_mesh;
+        Corefinement_mesh rhs_mesh;
+
+        if (prepare_corefinement_operand(lhs, lhs_mesh) &&
+            prepare_corefinement_operand(rhs, rhs_mesh))
+        {
+            Corefinement_mesh res;
+
+            // The operation fails, if the result can't be represented
+            // without changing the operands, e.g., if it isn't manifold:
+            if (corefinement_operation(lhs_mesh, rhs_mesh, res))
+            {
+                ++mesh_boolean_statistics().corefinement_count;
+
+                return Polyhedron_3(res);
+            }
+        }
+
+        ++mesh_boolean_statistics().nef_fallback_count;
+    }
+
+    ++mesh_boolean_statistics().nef_count;
+
+    Polyhedron_3 lhs_copy(lhs);
+    Polyhedron_3 rhs_copy(rhs);
+    Nef_polyhedron_3 res_nef = nef_operation(
+        Nef_polyhedron_3(lhs_copy), Nef_polyhedron_3(rhs_copy));
+    Corefinement_mesh res;
+
+    // A result that isn't a 2-manifold has no polyhedron:
+    if (!res_nef.is_simple())
+    {
+        throw std::runtime_error(
+            "The result of the mesh boolean operation isn't a 2-manifold.");
+    }
+
+    res_nef.convert_to_polyhedron(res);
+
+    return Polyhedron_3(res);
+}
+
+}
+
+// Returns the union of two closed meshes.  Throws std::invalid_argument, if
+// either mesh is open, and std::runtime_error, if the union isn't a
+// 2-manifold.
+inline Polyhedron_3 join(
+    const Polyhedron_3 &lhs, const Polyhedron_3 &rhs,
+    BooleanBackend backend = BooleanBackend::COREFINEMENT)
+{
+    return internal::mesh_boolean_operation(lhs, rhs, backend,
+        [](internal::Corefinement_mesh &lhs, internal::Corefinement_mesh &rhs,
+            internal::Corefinement_mesh &res)
+        {
+            return CGAL::Polygon_mesh_processing::corefine_and_compute_union(
+                lhs, rhs, res);
+        },
+        [](const Nef_polyhedron_3 &lhs, const Nef_polyhedron_3 &rhs)
+        {
+            return lhs + rhs;
+        });
+}
+
+// Returns the difference of two closed meshes.  Throws
+// std::invalid_argument, if either mesh is open, and std::runtime_error, if
+// the difference isn't a 2-manifold.
+inline Polyhedron_3 difference(
+    const Polyhedron_3 &lhs, const Polyhedron_3 &rhs,
+    BooleanBackend backend = BooleanBackend::COREFINEMENT)
+{
+    return internal::mesh_boolean_operation(lhs, rhs, backend,
+        [](internal::Corefinement_mesh &lhs, internal::Corefinement_mesh &rhs,
+            internal::Corefinement_mesh &res)
+        {
+            return CGAL::Polygon_mesh_processing::corefine_and_compute_difference(
+                lhs, rhs, res);
+        },
+        [](const Nef_polyhedron_3 &lhs, const Nef_polyhedron_3 &rhs)
+        {
+            return lhs - rhs;
+        });
+}
+
+// Returns the intersection of two closed meshes.  Throws
+// std::invalid_argument, if either mesh is open, and std::runtime_error, if
+// the intersection isn't a 2-manifold.
+inline Polyhedron_3 intersection(
+    const Polyhedron_3 &lhs, const Polyhedron_3 &rhs,
+    BooleanBackend backend = BooleanBackend::COREFINEMENT)
+{
+    return internal::mesh_boolean_operation(lhs, rhs, backend,
+        [](internal::Corefinement_mesh &lhs, internal::Corefinement_mesh &rhs,
+            internal::Corefinement_mesh &res)
+        {
+            return CGAL::Polygon_mesh_processing::corefine_and_compute_intersection(
+                lhs, rhs, res);
+        },
+        [](const Nef_polyhedron_3 &lhs, const Nef_polyhedron_3 &rhs)
+        {
+            return lhs * rhs;
+        });
+}
+
+}
+}
+
+#endif // _CPP_CAD_MESH_BOOLEAN_OPERATIONS_H
@@ -0,0 +1,313 @@
+#ifndef _CPP_CAD_MINKOWSKI_SUM_H
+#define _CPP_CAD_MINKOWSKI_SUM_H
+
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <CGAL/convex_decomposition_3.h>
+#include <CGAL/convex_hull_3.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include "Nef_polyhedron_3.h"
+#include "reference_frame.h"
+#include "union_all.h"
+#include "WorkerPool.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// The convex pieces of a bounded solid, as the vertices of each piece.
+class ConvexDecomposition
+{
+public:
+    typedef std::vector<Point_3> Piece;
+
+private:
+    std::vector<Piece> pieces;
+
+public:
+    // Throws std::invalid_argument, if the solid is unbounded, or not
+    // closed, since it can't be decomposed into convex polyhedra.
+    explicit ConvexDecomposition(const Nef_polyhedron_3 &solid)
+    {
+        if (solid.volumes_begin()->mark())
+        {
+            throw std::invalid_argument(
+                "Minkowski sums require bounded solids.");
+        }
+
+        if (!is_closed(solid))
+        {
+            throw std::invalid_argument(
+                "Minkowski sums require closed solids.");
+        }
+
+        // The decomposition adds facets to the solid, so work on a copy:
+        Nef_polyhedron_3::CGAL_Nef_polyhedron_3 decomposed(solid.applied());
+
+        CGAL::convex_decomposition_3(decomposed);
+
+        // The first volume is the unbounded outer volume:
+        Nef_polyhedron_3::Volume_const_iterator vit = decomposed.volumes_begin();
+
+        for (++vit; vit != decomposed.volumes_end(); ++vit)
+        {
+            if (!vit->mark())
+            {
+                continue;
+            }
+
+            CGAL::Polyhedron_3<Kernel> piece;
+
+            decomposed.convert_inner_shell_to_polyhedron(vit->shells_begin(), piece);
+            pieces.push_back(Piece(piece.points_begin(), piece.points_end()));
+        }
+    }
+
+    inline const std::vector<Piece> &get_pieces() const
+    {
+        return pieces;
+    }
+
+private:
+    // Returns true, if the solid contains its boundary.  Nef polyhedra
+    // don't keep items, whose mark doesn't matter, so the boundary of a
+    // closed solid is marked everywhere.
+    static bool is_closed(const Nef_polyhedron_3 &solid)
+    {
+        for (Nef_polyhedron_3::Vertex_const_iterator vit = solid.vertices_begin();
+            vit != solid.vertices_end();
+            ++vit)
+        {
+            if (!vit->mark())
+            {
+                return false;
+            }
+        }
+
+        for (Nef_polyhedron_3::Halfedge_const_iterator eit =
+                solid.halfedges_begin();
+            eit != solid.halfedges_end();
+            ++eit)
+        {
+            if (!eit->mark())
+            {
+                return false;
+            }
+        }
+
+        for (Nef_polyhedron_3::Halffacet_const_iterator fit =
+                solid.halffacets_begin();
+            fit != solid.halffacets_end();
+            ++fit)
+        {
+            if (!fit->mark())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+};
+
+// A memo of the convex decompositions of the most recently used solids.
+//     Decomposing is the most expensive part of a Minkowski sum with a
+// non-convex operand, so sweeping the same tool over many parts reuses its
+// decomposition.  Solids are identified by their SNC, which their copies
+// share, so looking them up doesn't read their coordinates.  Entries keep
+// their SNC alive, so its address isn't reused by another solid while it's
+// cached.
+class ConvexDecompositionCache
+{
+public:
+    typedef std::shared_ptr<const ConvexDecomposition> DecompositionPtr;
+
+private:
+    typedef const void *Key;
+
+    struct Entry
+    {
+        Nef_polyhedron_3 solid;
+        DecompositionPtr decomposition;
+        std::list<Key>::iterator lru_position;
+    };
+
+    std::mutex mutex;
+    std::unordered_map<Key, Entry> entries;
+    // Keys from the most to the least recently used:
+    std::list<Key> lru_order;
+    std::size_t capacity;
+
+public:
+    explicit ConvexDecompositionCache(std::size_t capacity = 64)
+    : capacity(capacity)
+    {}
+
+    ConvexDecompositionCache(const ConvexDecompositionCache &) = delete;
+    ConvexDecompositionCache &operator=(const ConvexDecompositionCache &) = delete;
+
+    static ConvexDecompositionCache &shared()
+    {
+        static ConvexDecompositionCache res;
+
+        return res;
+    }
+
+    // Returns the decomposition of a solid, decomposing it on a miss.
+    // Throws std::invalid_argument, if the solid is unbounded, or not
+    // closed.
+    DecompositionPtr get(const Nef_polyhedron_3 &solid)
+    {
+        // Applying pending transforms makes a new SNC, so solids with
+        // pending transforms always miss:
+        const Nef_polyhedron_3 applied = solid.applied();
+        Key key = applied.Ptr();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::unordered_map<Key, Entry>::iterator found = entries.find(key);
+
+            if (found != entries.end())
+            {
+                lru_order.splice(lru_order.begin(), lru_order,
+                    found->second.lru_position);
+
+                return found->second.decomposition;
+            }
+        }
+
+        // Decompose outside the lock, so other operands can be looked up:
+        DecompositionPtr res =
+            std::make_shared<const ConvexDecomposition>(applied);
+        std::lock_guard<std::mutex> lock(mutex);
+
+        if (capacity == 0 || entries.count(key) > 0)
+        {
+            return res;
+        }
+
+        lru_order.push_front(key);
+
+        Entry &entry = entries[key];
+
+        entry.solid = applied;
+        entry.decomposition = res;
+        entry.lru_position = lru_order.begin();
+
+        while (entries.size() > capacity)
+        {
+            entries.erase(lru_order.back());
+            lru_order.pop_back();
+        }
+
+        return res;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        entries.clear();
+        lru_order.clear();
+    }
+};
+
+namespace internal
+{
+
+// Returns the Minkowski sum of two convex pieces, the hull of the sums of
+// their vertices.  Returns an empty solid, if the sum is flat.
+inline Nef_polyhedron_3 convex_minkowski_sum(
+    const ConvexDecomposition::Piece &lhs, const ConvexDecomposition::Piece &rhs)
+{
+    std::vector<Point_3> sums;
+
+    sums.reserve(lhs.size() * rhs.size());
+    for (const Point_3 &lhs_point : lhs)
+    {
+        for (const Point_3 &rhs_point : rhs)
+        {
+            sums.push_back(lhs_point + (rhs_point - CGAL::ORIGIN));
+        }
+    }
+
+    CGAL::Polyhedron_3<Kernel> hull;
+
+    CGAL::convex_hull_3(sums.begin(), sums.end(), hull);
+
+    if (hull.size_of_vertices() < 4 || !hull.is_closed())
+    {
+        return Nef_polyhedron_3(Nef_polyhedron_3::EMPTY);
+    }
+
+    return Nef_polyhedron_3(hull);
+}
+
+}
+
+// Returns the Minkowski sum of two bounded, closed solids.  Throws
+// std::invalid_argument, if either solid is unbounded, or not closed.
+//     The operands are decomposed into convex pieces, which are cached in
+// `cache`.  The sums of each pair of pieces are convex hulls, which are
+// computed concurrently on `pool`, and merged with `union_all()`.
+inline Nef_polyhedron_3 minkowski_sum(
+    const Nef_polyhedron_3 &lhs, const Nef_polyhedron_3 &rhs,
+    WorkerPool &pool = WorkerPool::shared(),
+    ConvexDecompositionCache &cache = ConvexDecompositionCache::shared())
+{
+    if (lhs.is_empty() || rhs.is_empty())
+    {
+        return Nef_polyhedron_3(Nef_polyhedron_3::EMPTY);
+    }
+
+    ConvexDecompositionCache::DecompositionPtr lhs_decomposition = cache.get(lhs);
+    ConvexDecompositionCache::DecompositionPtr rhs_decomposition = cache.get(rhs);
+    std::vector<WorkerPool::Future<Nef_polyhedron_3>> sums;
+    // The sums refer to the decompositions' pieces:
+    WorkerPool::WaitGuard<Nef_polyhedron_3> sums_guard(sums);
+
+    for (const ConvexDecomposition::Piece &lhs_piece :
+        lhs_decomposition->get_pieces())
+    {
+        for (const ConvexDecomposition::Piece &rhs_piece :
+            rhs_decomposition->get_pieces())
+        {
+            const ConvexDecomposition::Piece *lhs_ptr = &lhs_piece;
+            const ConvexDecomposition::Piece *rhs_ptr = &rhs_piece;
+
+            sums.push_back(pool.submit([lhs_ptr, rhs_ptr]()
+                {
+                    return internal::convex_minkowski_sum(*lhs_ptr, *rhs_ptr);
+                }));
+        }
+    }
+
+    std::vector<Nef_polyhedron_3> pieces;
+
+    pieces.reserve(sums.size());
+    for (const WorkerPool::Future<Nef_polyhedron_3> &sum : sums)
+    {
+        Nef_polyhedron_3 piece = sum.get();
+
+        if (!piece.is_empty())
+        {
+            pieces.push_back(piece);
+        }
+    }
+
+    return union_all(pieces.begin(), pieces.end(), pool);
+}
+
+}
+}
+
+#endif // _CPP_CAD_MINKOWSKI_SUM_H
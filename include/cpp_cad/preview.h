@@ -0,0 +1,19 @@
+#ifndef _CPP_CAD_PREVIEW_H
+#define _CPP_CAD_PREVIEW_H
+
+// Configures cpp_cad for fast, inexact previews, and includes the library.
+//     Tessellation, transforms, and export run on doubles, instead of exact
+// number types.  Include this header before any other cpp_cad header, in
+// every translation unit of the program.
+
+#if defined(_CPP_CAD_REFERENCE_FRAME_H) && !defined(CPP_CAD_PREVIEW)
+#error "cpp_cad/preview.h must be included before other cpp_cad headers."
+#endif
+
+#ifndef CPP_CAD_PREVIEW
+#define CPP_CAD_PREVIEW
+#endif
+
+#include "../cpp_cad.h"
+
+#endif // _CPP_CAD_PREVIEW_H
@@ -2,15 +2,48 @@
 #define _CPP_CAD_REFERENCE_FRAME_H
 
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Nef_polyhedron_S2.h>
 #include <CGAL/Simple_cartesian.h>
 
 
+// The kernel of all cpp_cad classes is chosen when the headers are first
+// included.  Define `CPP_CAD_KERNEL` to a CGAL kernel type, or
+// `CPP_CAD_PREVIEW` (see "cpp_cad/preview.h") to use a double based kernel.
+// Every translation unit of a program must make the same choice.
+//     The kernel dependent classes are declared in an inline namespace named
+// after the kernel, so functions, which take, or return them from
+// translation units with different kernels fail to link, instead of
+// silently mixing layouts.  Define `CPP_CAD_KERNEL_NAMESPACE` to an
+// identifier of a custom kernel, to tell it apart from other custom kernels.
+#if defined(CPP_CAD_KERNEL)
+#define CPP_CAD_KERNEL_NAME_STRING(kernel) #kernel
+#define CPP_CAD_KERNEL_NAME_EXPAND(kernel) CPP_CAD_KERNEL_NAME_STRING(kernel)
+#define CPP_CAD_KERNEL_NAME CPP_CAD_KERNEL_NAME_EXPAND(CPP_CAD_KERNEL)
+#ifndef CPP_CAD_KERNEL_NAMESPACE
+#define CPP_CAD_KERNEL_NAMESPACE custom_kernel
+#endif
+#elif defined(CPP_CAD_PREVIEW)
+// Exact predicates keep polygon and mesh tests sane, but constructed
+// coordinates are rounded to doubles.  Nef polyhedron boolean operations
+// aren't robust on this kernel.
+#define CPP_CAD_KERNEL CGAL::Exact_predicates_inexact_constructions_kernel
+#define CPP_CAD_KERNEL_NAME "epick"
+#define CPP_CAD_KERNEL_NAMESPACE epick
+#else
+#define CPP_CAD_KERNEL CGAL::Exact_predicates_exact_constructions_kernel
+#define CPP_CAD_KERNEL_NAME "epeck"
+#define CPP_CAD_KERNEL_NAMESPACE epeck
+#endif
+
+
 namespace cpp_cad
 {
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
 
 // typedef CGAL::Simple_cartesian<Coordinate> Kernel;
-typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef CPP_CAD_KERNEL                                    Kernel;
 typedef Kernel::FT                                        Coordinate;
 typedef CGAL::Nef_polyhedron_S2<Kernel>                   Nef_polyhedron_S2;
 typedef Kernel::Segment_3                                 Segment_3;
@@ -19,6 +52,13 @@ typedef Kernel::Vector_3                                  Vector_3;
 typedef Kernel::Point_3                                   Point_3;
 typedef Kernel::Point_2                                   Point_2;
 
+// Identifies the kernel in persistent data, such as cached solid files:
+inline const char *kernel_name()
+{
+    return CPP_CAD_KERNEL_NAME;
+}
+
+}
 }
 
 #endif // _CPP_CAD_REFERENCE_FRAME_H
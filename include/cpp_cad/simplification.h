@@ -0,0 +1,299 @@
+#ifndef _CPP_CAD_SIMPLIFICATION_H
+#define _CPP_CAD_SIMPLIFICATION_H
+
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <set>
+
+#include <CGAL/boost/graph/copy_face_graph.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Polygon_mesh_processing/triangulate_faces.h>
+#include <CGAL/Polyhedron_3.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Midpoint_placement.h>
+
+#include "reference_frame.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// The facet counts before, and after a simplification.
+struct SimplificationReport
+{
+    std::size_t facet_count_before;
+    std::size_t facet_count_after;
+
+    SimplificationReport(
+        std::size_t facet_count_before = 0, std::size_t facet_count_after = 0)
+    : facet_count_before(facet_count_before),
+        facet_count_after(facet_count_after)
+    {}
+
+    void write(std::ostream &out) const
+    {
+        out << "Facets before: " << facet_count_before << std::endl <<
+            "Facets after: " << facet_count_after << std::endl;
+    }
+};
+
+// Sums the facet counts of all simplifications.
+struct SimplificationStatistics
+{
+    std::atomic<unsigned long> simplification_count;
+    std::atomic<unsigned long long> facet_count_before;
+    std::atomic<unsigned long long> facet_count_after;
+
+    SimplificationStatistics()
+    : simplification_count(0),
+        facet_count_before(0),
+        facet_count_after(0)
+    {}
+
+    void reset()
+    {
+        simplification_count = 0;
+        facet_count_before = 0;
+        facet_count_after = 0;
+    }
+
+    void add(const SimplificationReport &report)
+    {
+        ++simplification_count;
+        facet_count_before += report.facet_count_before;
+        facet_count_after += report.facet_count_after;
+    }
+
+    void write(std::ostream &out) const
+    {
+        out << "Simplifications: " << simplification_count << std::endl <<
+            "Facets before: " << facet_count_before << std::endl <<
+            "Facets after: " << facet_count_after << std::endl;
+    }
+};
+
+inline SimplificationStatistics &simplification_statistics()
+{
+    static SimplificationStatistics res;
+
+    return res;
+}
+
+namespace internal
+{
+
+typedef CGAL::Polyhedron_3<Kernel> Simplification_mesh;
+
+// Finds a vertex of the halfedge's facet, which isn't on the halfedge's
+// line.  Returns false, if the facet is degenerate.
+inline bool find_facet_apex(
+    Simplification_mesh::Halfedge_const_handle h, Point_3 &res)
+{
+    const Point_3 &p = h->opposite()->vertex()->point();
+    const Point_3 &q = h->vertex()->point();
+
+    for (Simplification_mesh::Halfedge_const_handle g = h->next();
+        g != h;
+        g = g->next())
+    {
+        if (!CGAL::collinear(p, q, g->vertex()->point()))
+        {
+            res = g->vertex()->point();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// Returns true, if the two facets of the edge lie in the same plane, and
+// face the same way, so removing the edge leaves a planar facet.
+inline bool is_flat_edge(Simplification_mesh::Halfedge_const_handle h)
+{
+    Point_3 apex, opposite_apex;
+
+    if (!find_facet_apex(h, apex) ||
+        !find_facet_apex(h->opposite(), opposite_apex))
+    {
+        return false;
+    }
+
+    const Point_3 &p = h->opposite()->vertex()->point();
+    const Point_3 &q = h->vertex()->point();
+
+    return CGAL::coplanar(p, q, apex, opposite_apex) &&
+        CGAL::coplanar_orientation(p, q, apex, opposite_apex) == CGAL::NEGATIVE;
+}
+
+// Returns the number of vertices, which the two facets of the edge share.
+inline std::size_t shared_vertex_count(
+    Simplification_mesh::Halfedge_const_handle h)
+{
+    std::set<const void *> vertices;
+    std::size_t res = 0;
+    Simplification_mesh::Halfedge_const_handle g = h;
+
+    do
+    {
+        vertices.insert(&*g->vertex());
+        g = g->next();
+    } while (g != h);
+
+    g = h->opposite();
+    do
+    {
+        res += vertices.count(&*g->vertex());
+        g = g->next();
+    } while (g != h->opposite());
+
+    return res;
+}
+
+// Removes edges between coplanar facets, which face the same way.
+//     Facets are only merged, if they share just the edge's vertices, and
+// the vertices have at least 3 edges, so the merged facets stay simple
+// polygons.
+// Returns the number of removed edges.
+inline std::size_t join_coplanar_facets(Simplification_mesh &mesh)
+{
+    std::size_t res = 0;
+
+    for (Simplification_mesh::Edge_iterator eit = mesh.edges_begin();
+        eit != mesh.edges_end();)
+    {
+        // Joining erases the edge, so advance first:
+        Simplification_mesh::Halfedge_handle h = eit;
+
+        ++eit;
+
+        if (h->is_border_edge() ||
+            h->facet() == h->opposite()->facet() ||
+            h->vertex()->vertex_degree() < 3 ||
+            h->opposite()->vertex()->vertex_degree() < 3 ||
+            shared_vertex_count(h) != 2 ||
+            !is_flat_edge(h))
+        {
+            continue;
+        }
+
+        mesh.join_facet(h);
+        ++res;
+    }
+
+    return res;
+}
+
+// Removes vertices in the middle of straight edge chains.  Returns the
+// number of removed vertices.
+inline std::size_t join_collinear_edges(Simplification_mesh &mesh)
+{
+    std::size_t res = 0;
+
+    for (Simplification_mesh::Vertex_iterator vit = mesh.vertices_begin();
+        vit != mesh.vertices_end();)
+    {
+        // Joining erases the vertex, so advance first:
+        Simplification_mesh::Vertex_handle v = vit;
+
+        ++vit;
+
+        if (v->vertex_degree() != 2)
+        {
+            continue;
+        }
+
+        // The halfedges into, and out of the vertex:
+        Simplification_mesh::Halfedge_handle in = v->halfedge();
+        Simplification_mesh::Halfedge_handle out = in->next();
+
+        if (in->is_border_edge() || out->is_border_edge() ||
+            in->facet()->facet_degree() <= 3 ||
+            in->opposite()->facet()->facet_degree() <= 3 ||
+            !CGAL::collinear(
+                in->opposite()->vertex()->point(), v->point(),
+                out->vertex()->point()))
+        {
+            continue;
+        }
+
+        // Removes `out->opposite()->vertex()`, which is `v`:
+        mesh.join_vertex(out);
+        ++res;
+    }
+
+    return res;
+}
+
+// Merges coplanar facets, and collinear edges, without counting the
+// simplification.
+inline void join_coplanar_features(Simplification_mesh &mesh)
+{
+    // Removing a vertex can make an edge removable, and vice versa:
+    while (join_collinear_edges(mesh) + join_coplanar_facets(mesh) > 0)
+    {}
+}
+
+}
+
+// Merges coplanar adjacent facets of a mesh, and removes vertices between
+// collinear edges.  The mesh bounds the same point set afterwards.
+inline SimplificationReport merge_coplanar_facets(
+    CGAL::Polyhedron_3<Kernel> &mesh)
+{
+    SimplificationReport res(mesh.size_of_facets());
+
+    internal::join_coplanar_features(mesh);
+
+    res.facet_count_after = mesh.size_of_facets();
+    simplification_statistics().add(res);
+
+    return res;
+}
+
+// Collapses the edges of a closed mesh, which are shorter than `tolerance`,
+// and then merges its coplanar facets.  Counts as one simplification, from
+// the facets of the mesh to those of the result.
+//     Collapsing moves vertices, so the result approximates the mesh.  It
+// may even intersect itself, so it's meant for exports, not for boolean
+// operations.
+inline SimplificationReport decimate(
+    CGAL::Polyhedron_3<Kernel> &mesh, const Kernel::FT &tolerance)
+{
+    typedef CGAL::Surface_mesh<Point_3> Surface_mesh;
+
+    namespace PMP = CGAL::Polygon_mesh_processing;
+    namespace SMS = CGAL::Surface_mesh_simplification;
+
+    SimplificationReport res(mesh.size_of_facets());
+    Surface_mesh triangles;
+
+    CGAL::copy_face_graph(mesh, triangles);
+    PMP::triangulate_faces(triangles);
+
+    SMS::Edge_length_stop_predicate<Kernel::FT> stop(tolerance);
+
+    SMS::edge_collapse(triangles, stop,
+        CGAL::parameters::get_cost(SMS::Edge_length_cost<Surface_mesh>())
+            .get_placement(SMS::Midpoint_placement<Surface_mesh>()));
+
+    mesh.clear();
+    CGAL::copy_face_graph(triangles, mesh);
+    internal::join_coplanar_features(mesh);
+
+    res.facet_count_after = mesh.size_of_facets();
+    simplification_statistics().add(res);
+
+    return res;
+}
+
+}
+}
+
+#endif // _CPP_CAD_SIMPLIFICATION_H
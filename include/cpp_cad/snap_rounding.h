@@ -0,0 +1,180 @@
+#ifndef _CPP_CAD_SNAP_ROUNDING_H
+#define _CPP_CAD_SNAP_ROUNDING_H
+
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <ostream>
+#include <sstream>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+#include <CGAL/Polygon_mesh_processing/triangulate_faces.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include "reference_frame.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// Counts snap rounding results, and optionally measures how many bits the
+// exact coordinates take before and after rounding.
+struct SnapRoundingStatistics
+{
+    std::atomic<unsigned long> snap_count;
+    // Solids left unrounded, because they weren't 2-manifolds, or rounding
+    // would have made them invalid:
+    std::atomic<unsigned long> rejected_count;
+    // Measuring forces the exact coordinates, so it's off by default:
+    std::atomic<bool> is_measuring_bit_lengths;
+    std::atomic<unsigned long long> coordinate_count;
+    std::atomic<unsigned long long> bit_length_before_sum;
+    std::atomic<unsigned long long> bit_length_after_sum;
+
+    SnapRoundingStatistics()
+    : snap_count(0),
+        rejected_count(0),
+        is_measuring_bit_lengths(false),
+        coordinate_count(0),
+        bit_length_before_sum(0),
+        bit_length_after_sum(0)
+    {}
+
+    void reset()
+    {
+        snap_count = 0;
+        rejected_count = 0;
+        coordinate_count = 0;
+        bit_length_before_sum = 0;
+        bit_length_after_sum = 0;
+    }
+
+    double average_bit_length_before() const
+    {
+        return coordinate_count == 0 ?
+            0 : double(bit_length_before_sum) / coordinate_count;
+    }
+
+    double average_bit_length_after() const
+    {
+        return coordinate_count == 0 ?
+            0 : double(bit_length_after_sum) / coordinate_count;
+    }
+
+    void write(std::ostream &out) const
+    {
+        out << "Snaps: " << snap_count << std::endl <<
+            "Rejected snaps: " << rejected_count << std::endl <<
+            "Measured coordinates: " << coordinate_count << std::endl <<
+            "Average bit length before: " << average_bit_length_before() << std::endl <<
+            "Average bit length after: " << average_bit_length_after() << std::endl;
+    }
+};
+
+inline SnapRoundingStatistics &snap_rounding_statistics()
+{
+    static SnapRoundingStatistics res;
+
+    return res;
+}
+
+namespace internal
+{
+
+// Returns the approximate number of bits of the numerator and denominator of
+// a coordinate's exact value.
+inline unsigned long coordinate_bit_length(const Kernel::FT &value)
+{
+    std::ostringstream text;
+    unsigned long digit_c = 0;
+
+    text << CGAL::exact(value);
+    for (char c : text.str())
+    {
+        if (std::isdigit(static_cast<unsigned char>(c)))
+        {
+            ++digit_c;
+        }
+    }
+
+    // log2(10) bits per digit:
+    return static_cast<unsigned long>(std::ceil(digit_c * 3.321928));
+}
+
+inline Kernel::FT snap_coordinate(const Kernel::FT &value, const Kernel::FT &grid)
+{
+    return Kernel::FT(std::round(CGAL::to_double(value / grid))) * grid;
+}
+
+// Rounds the vertices of a closed mesh to a grid, after triangulating it.
+// Returns false, if rounding collapses a face, or makes the mesh intersect
+// itself.  The mesh is garbage then.
+inline bool snap_to_grid(CGAL::Polyhedron_3<Kernel> &mesh, const Kernel::FT &grid)
+{
+    typedef CGAL::Polyhedron_3<Kernel> Mesh;
+
+    namespace PMP = CGAL::Polygon_mesh_processing;
+
+    SnapRoundingStatistics &statistics = snap_rounding_statistics();
+    bool is_measuring = statistics.is_measuring_bit_lengths;
+
+    // Snapping a vertex would make larger faces non-planar:
+    if (!CGAL::is_triangle_mesh(mesh))
+    {
+        PMP::triangulate_faces(mesh);
+    }
+
+    for (Mesh::Vertex_iterator vit = mesh.vertices_begin();
+        vit != mesh.vertices_end();
+        ++vit)
+    {
+        const Point_3 &point = vit->point();
+        Point_3 snapped(
+            snap_coordinate(point.x(), grid),
+            snap_coordinate(point.y(), grid),
+            snap_coordinate(point.z(), grid));
+
+        if (is_measuring)
+        {
+            unsigned long before = 0;
+            unsigned long after = 0;
+
+            for (int i = 0; i < 3; ++i)
+            {
+                before += coordinate_bit_length(point[i]);
+                after += coordinate_bit_length(snapped[i]);
+            }
+            statistics.coordinate_count += 3;
+            statistics.bit_length_before_sum += before;
+            statistics.bit_length_after_sum += after;
+        }
+
+        vit->point() = snapped;
+    }
+
+    for (Mesh::Facet_iterator fit = mesh.facets_begin();
+        fit != mesh.facets_end();
+        ++fit)
+    {
+        Mesh::Halfedge_handle h = fit->halfedge();
+
+        if (CGAL::collinear(h->vertex()->point(),
+            h->next()->vertex()->point(),
+            h->next()->next()->vertex()->point()))
+        {
+            return false;
+        }
+    }
+
+    return !PMP::does_self_intersect(mesh);
+}
+
+}
+
+}
+}
+
+#endif // _CPP_CAD_SNAP_ROUNDING_H
@@ -0,0 +1,129 @@
+#ifndef _CPP_CAD_UNION_ALL_H
+#define _CPP_CAD_UNION_ALL_H
+
+#include <future>
+#include <vector>
+
+#include "Nef_polyhedron_3.h"
+#include "WorkerPool.h"
+
+
+namespace cpp_cad
+{
+inline namespace CPP_CAD_KERNEL_NAMESPACE
+{
+
+// Returns the union of the solids in [begin, end).
+//     The operands are merged pairwise in a balanced tree, so each union runs
+// on operands of similar size, and the merges on each tree level run
+// concurrently on `pool`.  The result is the same point set as adding the
+// operands to an empty solid with `+=` in sequence.
+template <class InputIterator>
+Nef_polyhedron_3 union_all(
+    InputIterator begin, InputIterator end,
+    WorkerPool &pool = WorkerPool::shared())
+{
+    std::vector<Nef_polyhedron_3> level;
+
+    for (; begin != end; ++begin)
+    {
+        level.push_back(*begin);
+    }
+
+    if (level.empty())
+    {
+        return Nef_polyhedron_3(Nef_polyhedron_3::EMPTY);
+    }
+
+    while (level.size() > 1)
+    {
+        std::vector<WorkerPool::Future<Nef_polyhedron_3>> merges;
+        // The merges refer to `level`:
+        WorkerPool::WaitGuard<Nef_polyhedron_3> merges_guard(merges);
+
+        merges.reserve(level.size() / 2);
+        for (std::size_t i = 0; i + 1 < level.size(); i += 2)
+        {
+            const Nef_polyhedron_3 *lhs = &level[i];
+            const Nef_polyhedron_3 *rhs = &level[i + 1];
+
+            merges.push_back(pool.submit([lhs, rhs]()
+                {
+                    Nef_polyhedron_3 res = *lhs + *rhs;
+
+                    return res;
+                }));
+        }
+
+        std::vector<Nef_polyhedron_3> next_level;
+
+        next_level.reserve((level.size() + 1) / 2);
+        for (auto &merge : merges)
+        {
+            next_level.push_back(merge.get());
+        }
+
+        // An odd operand out is carried to the next level unchanged:
+        if (level.size() % 2 != 0)
+        {
+            next_level.push_back(level.back());
+        }
+
+        level.swap(next_level);
+    }
+
+    return level.front();
+}
+
+// Accumulates a union with the same semantics as `scene += part`, but
+// defers the merges to a single `union_all()` call.
+class UnionAccumulator
+{
+private:
+    std::vector<Nef_polyhedron_3> operands;
+    WorkerPool &pool;
+
+public:
+    explicit UnionAccumulator(WorkerPool &pool = WorkerPool::shared())
+    : pool(pool)
+    {}
+
+    inline void reserve(std::size_t operand_count)
+    {
+        operands.reserve(operand_count);
+    }
+
+    UnionAccumulator &operator+=(const Nef_polyhedron_3 &operand)
+    {
+        // Empty operands don't change the union:
+        if (!operand.is_empty())
+        {
+            operands.push_back(operand);
+        }
+
+        return *this;
+    }
+
+    // Merges the accumulated operands, and returns their union.
+    Nef_polyhedron_3 result()
+    {
+        if (operands.size() > 1)
+        {
+            Nef_polyhedron_3 res = union_all(operands.begin(), operands.end(), pool);
+
+            operands.assign(1, res);
+        }
+
+        if (operands.empty())
+        {
+            return Nef_polyhedron_3(Nef_polyhedron_3::EMPTY);
+        }
+
+        return operands.front();
+    }
+};
+
+}
+}
+
+#endif // _CPP_CAD_UNION_ALL_H